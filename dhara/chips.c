@@ -0,0 +1,31 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include "chips.h"
+
+void dhara_chips_init(struct dhara_chips *c, const struct dhara_nand *chip,
+		      uint8_t log2_chips)
+{
+	c->chip = chip;
+	c->log2_chips = log2_chips;
+
+	c->nand.log2_page_size = chip->log2_page_size;
+	c->nand.log2_ppb = chip->log2_ppb;
+	c->nand.num_blocks = chip->num_blocks << log2_chips;
+	c->nand.log2_planes = chip->log2_planes;
+	c->nand.first_block = 0;
+}
@@ -0,0 +1,82 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#ifndef DHARA_CHIPS_H_
+#define DHARA_CHIPS_H_
+
+#include "nand.h"
+
+/* A composite device made from several identical chips. The chips'
+ * blocks are numbered consecutively (all of chip 0, then all of chip
+ * 1, and so on), and a single map can span the whole device.
+ *
+ * The composite adds capacity, not concurrency. The journal fills one
+ * chip before moving to the next, and has at most one operation in
+ * progress, so only one chip is busy at a time. To keep several chips
+ * busy, split the composite into partitions (see part.h) on chip
+ * boundaries and run a separate map on each.
+ *
+ * The NAND functions are called on the composite with composite block
+ * and page numbers. Your implementation should use dhara_chips_block()
+ * and dhara_chips_page() to find the chip which owns each address and
+ * dispatch to it. If the map is split into partitions, the addresses
+ * are still those of the composite.
+ */
+struct dhara_chips {
+	/* The composite device. Give this to the map. */
+	struct dhara_nand		nand;
+
+	/* Geometry of a single chip */
+	const struct dhara_nand		*chip;
+
+	/* Base-2 logarithm of the number of chips */
+	uint8_t				log2_chips;
+};
+
+/* Initialize a composite of (1 << log2_chips) chips, each with the
+ * geometry given.
+ */
+void dhara_chips_init(struct dhara_chips *c, const struct dhara_nand *chip,
+		      uint8_t log2_chips);
+
+/* Find the chip which owns a composite block, and the block number
+ * within that chip.
+ */
+static inline unsigned int dhara_chips_block(const struct dhara_chips *c,
+					     dhara_block_t b,
+					     dhara_block_t *local)
+{
+	*local = b % c->chip->num_blocks;
+	return b / c->chip->num_blocks;
+}
+
+/* Find the chip which owns a composite page, and the page number within
+ * that chip.
+ */
+static inline unsigned int dhara_chips_page(const struct dhara_chips *c,
+					    dhara_page_t p,
+					    dhara_page_t *local)
+{
+	const uint8_t log2_ppb = c->chip->log2_ppb;
+	dhara_block_t b;
+	const unsigned int chip = dhara_chips_block(c, p >> log2_ppb, &b);
+
+	*local = (b << log2_ppb) | (p & ((1 << log2_ppb) - 1));
+	return chip;
+}
+
+#endif
@@ -18,6 +18,14 @@
 #include "journal.h"
 #include "bytes.h"
 
+#if defined(DHARA_NAND_CACHE_PROG) && !defined(DHARA_NAND_ASYNC)
+#error DHARA_NAND_CACHE_PROG requires DHARA_NAND_ASYNC
+#endif
+
+#if defined(DHARA_NAND_OOB) && defined(DHARA_NAND_ASYNC)
+#error DHARA_NAND_OOB is incompatible with DHARA_NAND_ASYNC
+#endif
+
 /************************************************************************
  * Metapage binary format
  */
@@ -78,13 +86,6 @@ static inline void hdr_set_bb_last(uint8_t *buf, dhara_page_t count)
 	dhara_w32(buf + 12, count);
 }
 
-/* Clear user metadata */
-static inline void hdr_clear_user(uint8_t *buf, uint8_t log2_page_size)
-{
-	memset(buf + DHARA_HEADER_SIZE + DHARA_COOKIE_SIZE, 0xff,
-	       (1 << log2_page_size) - DHARA_HEADER_SIZE - DHARA_COOKIE_SIZE);
-}
-
 /* Obtain pointers to user data */
 static inline size_t hdr_user_offset(uint8_t which)
 {
@@ -92,6 +93,12 @@ static inline size_t hdr_user_offset(uint8_t which)
 		which * DHARA_META_SIZE;
 }
 
+/* Clear user metadata, up to the given offset (the summary) */
+static inline void hdr_clear_user(uint8_t *buf, size_t end)
+{
+	memset(buf + hdr_user_offset(0), 0xff, end - hdr_user_offset(0));
+}
+
 /************************************************************************
  * Page geometry helpers
  */
@@ -109,6 +116,146 @@ static inline int align_eq(dhara_page_t a, dhara_page_t b,
 	return !((a ^ b) >> n);
 }
 
+/* Number of user pages in each checkpoint group */
+static inline int group_upages(const struct dhara_journal *j)
+{
+	return (1 << j->log2_ppc) - j->meta_pages;
+}
+
+/* Is this the last user page in its group? */
+static inline int is_last_upage(const struct dhara_journal *j,
+				dhara_page_t p)
+{
+	return is_aligned(p + 1 + j->meta_pages, j->log2_ppc);
+}
+
+#ifndef DHARA_NAND_OOB
+/* Metadata records are kept on the last meta_pages pages of each
+ * checkpoint group. The checkpoint page itself, which is the last page
+ * in the group and the first page of the metadata buffer, holds the
+ * header and cookie, followed by as many records as will fit. Further
+ * records are held on the pages of the buffer which follow, and are
+ * programmed (in order) just before the checkpoint page. No record is
+ * split across pages.
+ */
+static inline int slots_first(uint8_t log2_page_size)
+{
+	return ((1 << log2_page_size) - DHARA_HEADER_SIZE -
+		DHARA_COOKIE_SIZE) / DHARA_META_SIZE;
+}
+
+static inline int slots_rest(uint8_t log2_page_size)
+{
+	return (1 << log2_page_size) / DHARA_META_SIZE;
+}
+
+/* Find the metadata record for a user page: the page within the
+ * metadata buffer, and the offset within that page.
+ */
+static size_t meta_offset(const struct dhara_journal *j, dhara_page_t p,
+			  int *which)
+{
+	const int first = slots_first(j->nand->log2_page_size);
+	const int rest = slots_rest(j->nand->log2_page_size);
+	int slot = p & ((1 << j->log2_ppc) - 1);
+
+	if (slot < first) {
+		*which = 0;
+		return hdr_user_offset(slot);
+	}
+
+	slot -= first;
+	*which = 1 + slot / rest;
+	return (slot % rest) * DHARA_META_SIZE;
+}
+
+/* Where is the given page of the metadata buffer stored, for the group
+ * containing p?
+ */
+static dhara_page_t meta_page(const struct dhara_journal *j,
+			      dhara_page_t p, int which)
+{
+	const dhara_page_t ppc_mask = (1 << j->log2_ppc) - 1;
+
+	if (!which)
+		return p | ppc_mask;
+
+	return (p & ~ppc_mask) + group_upages(j) + which - 1;
+}
+#endif
+
+/* The summary follows the user metadata on the checkpoint page. It
+ * holds the number of the checkpoint's root page, a bitmap of the
+ * 32-bit words of its metadata which aren't 0xffffffff, and then those
+ * words in order. If they don't all fit, the page number is left as
+ * 0xffffffff and there's no summary.
+ */
+#define SUMMARY_WORDS		(DHARA_META_SIZE >> 2)
+#define SUMMARY_MASK_SIZE	((SUMMARY_WORDS + 7) >> 3)
+#define SUMMARY_HDR_SIZE	(4 + SUMMARY_MASK_SIZE)
+
+static inline size_t summary_offset(const struct dhara_journal *j)
+{
+#ifdef DHARA_NAND_OOB
+	return hdr_user_offset(0);
+#else
+	const int first = slots_first(j->nand->log2_page_size);
+	const int count = group_upages(j);
+
+	return hdr_user_offset(count < first ? count : first);
+#endif
+}
+
+/* Clear buffered user metadata (but not the summary) */
+static void clear_user(struct dhara_journal *j)
+{
+	const uint8_t log2_page_size = j->nand->log2_page_size;
+
+	hdr_clear_user(j->page_buf, summary_offset(j));
+	memset(j->page_buf + (1 << log2_page_size), 0xff,
+	       (size_t)(j->meta_pages - 1) << log2_page_size);
+}
+
+static size_t summary_size(const struct dhara_journal *j)
+{
+	const size_t page_size = 1 << j->nand->log2_page_size;
+	const size_t offset = summary_offset(j);
+	size_t size;
+
+	if (offset + SUMMARY_HDR_SIZE + 4 > page_size)
+		return 0;
+
+	size = page_size - offset;
+	if (size > SUMMARY_HDR_SIZE + DHARA_META_SIZE)
+		size = SUMMARY_HDR_SIZE + DHARA_META_SIZE;
+
+	return size;
+}
+
+/* The summary in the page buffer becomes valid once the checkpoint
+ * containing it is known to be good.
+ */
+static void commit_summary(struct dhara_journal *j, dhara_page_t root)
+{
+	j->summary_root = DHARA_PAGE_NONE;
+	if (summary_size(j) &&
+	    (dhara_r32(j->page_buf + summary_offset(j)) == root))
+		j->summary_root = root;
+}
+
+/* Physical addresses of journal blocks and pages */
+static inline dhara_block_t phys_block(const struct dhara_journal *j,
+				       dhara_block_t b)
+{
+	return dhara_nand_block_addr(j->nand, b);
+}
+
+static inline dhara_page_t phys_page(const struct dhara_journal *j,
+				     dhara_page_t p)
+{
+	return dhara_nand_page_addr(j->nand, p);
+}
+
 /* What is the successor of this block? */
 static dhara_block_t next_block(const struct dhara_nand *n, dhara_block_t blk)
 {
@@ -123,8 +270,8 @@ static dhara_page_t next_upage(const struct dhara_journal *j,
 			       dhara_page_t p)
 {
 	p++;
-	if (is_aligned(p + 1, j->log2_ppc))
-		p++;
+	if (is_aligned(p + j->meta_pages, j->log2_ppc))
+		p += j->meta_pages;
 
 	if (p >= (j->nand->num_blocks << j->nand->log2_ppb))
 		p = 0;
@@ -132,29 +279,23 @@ static dhara_page_t next_upage(const struct dhara_journal *j,
 	return p;
 }
 
+#ifndef DHARA_NAND_OOB
 /* Calculate a checkpoint period: the largest value of ppc such that
- * (2**ppc - 1) metadata blocks can fit on a page with one journal
- * header.
+ * (2**ppc - meta_pages) metadata blocks can fit on the given number of
+ * metadata pages, the first of which also holds the journal header.
  */
-static int choose_ppc(int log2_page_size, int max)
+static int choose_ppc(int log2_page_size, int max, int meta_pages)
 {
-	const int max_meta = (1 << log2_page_size) -
-		DHARA_HEADER_SIZE - DHARA_COOKIE_SIZE;
-	int total_meta = DHARA_META_SIZE;
+	const int slots = slots_first(log2_page_size) +
+		(meta_pages - 1) * slots_rest(log2_page_size);
 	int ppc = 1;
 
-	while (ppc < max) {
-		total_meta <<= 1;
-		total_meta += DHARA_META_SIZE;
-
-		if (total_meta > max_meta)
-			break;
-
+	while ((ppc < max) && ((2 << ppc) - meta_pages <= slots))
 		ppc++;
-	}
 
 	return ppc;
 }
+#endif
 
 /************************************************************************
  * Journal setup/resume
@@ -188,12 +329,17 @@ static void reset_journal(struct dhara_journal *j)
 	j->tail = 0;
 	j->tail_sync = 0;
 	j->root = DHARA_PAGE_NONE;
+	j->root_sync = DHARA_PAGE_NONE;
+	j->pending = DHARA_PAGE_NONE;
+	j->erased_group = DHARA_BLOCK_NONE;
+	j->summary_root = DHARA_PAGE_NONE;
 
 	/* No recovery required */
 	clear_recovery(j);
 
 	/* Empty metadata buffer */
-	memset(j->page_buf, 0xff, 1 << j->nand->log2_page_size);
+	memset(j->page_buf, 0xff,
+	       (size_t)j->meta_pages << j->nand->log2_page_size);
 }
 
 static void roll_stats(struct dhara_journal *j)
@@ -203,14 +349,61 @@ static void roll_stats(struct dhara_journal *j)
 	j->epoch++;
 }
 
-void dhara_journal_init(struct dhara_journal *j,
-			const struct dhara_nand *n,
-			uint8_t *page_buf)
+int dhara_journal_init(struct dhara_journal *j,
+		       const struct dhara_nand *n,
+		       uint8_t *page_buf)
 {
+	const dhara_block_t plane_mask = (1 << n->log2_planes) - 1;
+
 	/* Set fixed parameters */
 	j->nand = n;
 	j->page_buf = page_buf;
-	j->log2_ppc = choose_ppc(n->log2_page_size, n->log2_ppb);
+#ifdef DHARA_NAND_OOB
+	/* User metadata is kept out-of-band, so the checkpoint page holds
+	 * only the header, and we need only one per block.
+	 */
+	j->log2_ppc = n->log2_ppb;
+#else
+	j->log2_ppc = choose_ppc(n->log2_page_size, n->log2_ppb, 1);
+#endif
+	j->meta_pages = 1;
+	j->resume_ops = 0;
+	j->tail_pin = DHARA_PAGE_NONE;
+	j->spare_buf = NULL;
+
+	reset_journal(j);
+
+	/* Blocks must divide evenly into plane groups */
+	return (n->num_blocks & plane_mask) ? -1 : 0;
+}
+
+void dhara_journal_set_meta_buf(struct dhara_journal *j, uint8_t *buf,
+				 uint8_t pages)
+{
+	j->page_buf = buf;
+
+#ifndef DHARA_NAND_OOB
+	/* Recovery dumps the metadata buffer into the first group of a
+	 * fresh block, so each group must have more user pages than
+	 * metadata pages.
+	 */
+	while (pages > 1) {
+		j->log2_ppc = choose_ppc(j->nand->log2_page_size,
+					 j->nand->log2_ppb, pages);
+		if ((1 << j->log2_ppc) > (pages << 1))
+			break;
+
+		pages--;
+	}
+
+	if (pages <= 1)
+		j->log2_ppc = choose_ppc(j->nand->log2_page_size,
+					 j->nand->log2_ppb, 1);
+
+	j->meta_pages = pages ? pages : 1;
+#else
+	(void)pages;
+#endif
 
 	reset_journal(j);
 }
@@ -231,13 +424,16 @@ static int find_checkblock(struct dhara_journal *j,
 			(blk << j->nand->log2_ppb) |
 			((1 << j->log2_ppc) - 1);
 
-		if (!(dhara_nand_is_bad(j->nand, blk) ||
-		      dhara_nand_read(j->nand, p,
-				      0, 1 << j->nand->log2_page_size,
-				      j->page_buf, err)) &&
-		    hdr_has_magic(j->page_buf)) {
-			*where = blk;
-			return 0;
+		j->resume_ops++;
+		if (!dhara_nand_is_bad(j->nand, phys_block(j, blk))) {
+			j->resume_ops++;
+			if (!dhara_nand_read(j->nand, phys_page(j, p),
+					     0, 1 << j->nand->log2_page_size,
+					     j->page_buf, err) &&
+			    hdr_has_magic(j->page_buf)) {
+				*where = blk;
+				return 0;
+			}
 		}
 
 		blk++;
@@ -301,9 +497,11 @@ static int cp_free(struct dhara_journal *j, dhara_page_t first_user)
 	const int count = 1 << j->log2_ppc;
 	int i;
 
-	for (i = 0; i < count; i++)
-		if (!dhara_nand_is_free(j->nand, first_user + i))
+	for (i = 0; i < count; i++) {
+		j->resume_ops++;
+		if (!dhara_nand_is_free(j->nand, phys_page(j, first_user + i)))
 			return 0;
+	}
 
 	return 1;
 }
@@ -349,12 +547,13 @@ static int find_root(struct dhara_journal *j, dhara_page_t start,
 		const dhara_page_t p = (blk << j->nand->log2_ppb) +
 			((i + 1) << j->log2_ppc) - 1;
 
-		if (!dhara_nand_read(j->nand, p,
+		j->resume_ops++;
+		if (!dhara_nand_read(j->nand, phys_page(j, p),
 				     0, 1 << j->nand->log2_page_size,
 				     j->page_buf, err) &&
 		    (hdr_has_magic(j->page_buf)) &&
 		    (hdr_get_epoch(j->page_buf) == j->epoch)) {
-			j->root = p - 1;
+			j->root = p - j->meta_pages;
 			return 0;
 		}
 
@@ -368,54 +567,53 @@ static int find_root(struct dhara_journal *j, dhara_page_t start,
 static int find_head(struct dhara_journal *j, dhara_page_t start,
 		     dhara_error_t *err)
 {
-	j->head = next_upage(j, start);
-	if (!j->head)
-		roll_stats(j);
+	const unsigned int ppc = 1 << j->log2_ppc;
+	unsigned int n = 0;
 
-	/* Starting from the last good checkpoint, find either:
+	/* Starting from the last programmed checkpoint group, find
+	 * either:
 	 *
-	 *   (a) the next free user-page in the same block
-	 *   (b) or, the first page of the next block
+	 *   (a) the next free user-page in the same group
+	 *   (b) or, the first page of the next group
+	 *
+	 * find_last_group() has already established that the group
+	 * following this one is unprogrammed (or that we're at the end
+	 * of the block), so only the final group needs to be probed.
 	 *
 	 * The block we end up on might be bad, but that's ok -- we'll
 	 * skip it when we go to prepare the next write.
 	 */
-	for (;;) {
-		/* How many free pages trail this checkpoint group? */
-		const unsigned int ppc = 1 << j->log2_ppc;
-		unsigned int n = 0;
-		dhara_page_t first = j->head & ~(dhara_page_t)(ppc - 1);
-
-		while (n < ppc &&
-			dhara_nand_is_free(j->nand, first + ppc - n - 1))
-			n++;
-
-		/* If we have some, then we've found our next free
-		 * userpage.
-		 */
-		if (n > 1) {
-			j->head = first + ppc - n;
+	while (n < ppc) {
+		j->resume_ops++;
+		if (!dhara_nand_is_free(j->nand,
+					phys_page(j, start + ppc - n - 1)))
 			break;
-		}
+		n++;
+	}
 
-		/* Skip to the next checkpoint group */
-		j->head = first + ppc;
-		if (j->head >= (j->nand->num_blocks << j->nand->log2_ppb)) {
-			j->head = 0;
-			roll_stats(j);
-		}
+	/* If we have more than the metadata pages, then we've found our
+	 * next free user-page.
+	 */
+	if (n > j->meta_pages) {
+		j->head = start + ppc - n;
+		return 0;
+	}
 
-		/* If we hit the end of the block, we're done */
-		if (is_aligned(j->head, j->nand->log2_ppb)) {
-			/* Make sure we don't chase over the tail */
-			if (align_eq(j->head, j->tail, j->nand->log2_ppb))
-				j->tail = next_block(j->nand,
-					j->tail >> j->nand->log2_ppb) <<
-						j->nand->log2_ppb;
-			break;
-		}
+	/* Skip to the next checkpoint group */
+	j->head = start + ppc;
+	if (j->head >= (j->nand->num_blocks << j->nand->log2_ppb)) {
+		j->head = 0;
+		roll_stats(j);
 	}
 
+	/* If we hit the end of the block, make sure we don't chase over
+	 * the tail.
+	 */
+	if (is_aligned(j->head, j->nand->log2_ppb) &&
+	    align_eq(j->head, j->tail, j->nand->log2_ppb))
+		j->tail = next_block(j->nand,
+			j->tail >> j->nand->log2_ppb) << j->nand->log2_ppb;
+
 	return 0;
 }
 
@@ -424,6 +622,8 @@ int dhara_journal_resume(struct dhara_journal *j, dhara_error_t *err)
 	dhara_block_t first, last;
 	dhara_page_t last_group;
 
+	j->resume_ops = 0;
+
 	/* Find the first checkpoint-containing block */
 	if (find_checkblock(j, 0, &first, err) < 0) {
 		reset_journal(j);
@@ -449,9 +649,14 @@ int dhara_journal_resume(struct dhara_journal *j, dhara_error_t *err)
 	j->tail = hdr_get_tail(j->page_buf);
 	j->bb_current = hdr_get_bb_current(j->page_buf);
 	j->bb_last = hdr_get_bb_last(j->page_buf);
-	hdr_clear_user(j->page_buf, j->nand->log2_page_size);
+	clear_user(j);
 
-	/* Perform another linear scan to find the next free user page */
+	/* Images written without summaries have 0xff in the slack
+	 * space, which never matches a valid root.
+	 */
+	commit_summary(j, j->root);
+
+	/* Probe the last group to find the next free user page */
 	if (find_head(j, last_group, err) < 0) {
 		reset_journal(j);
 		return -1;
@@ -459,6 +664,9 @@ int dhara_journal_resume(struct dhara_journal *j, dhara_error_t *err)
 
 	j->flags = 0;
 	j->tail_sync = j->tail;
+	j->root_sync = j->root;
+	j->pending = DHARA_PAGE_NONE;
+	j->erased_group = DHARA_BLOCK_NONE;
 
 	clear_recovery(j);
 	return 0;
@@ -476,8 +684,8 @@ dhara_page_t dhara_journal_capacity(const struct dhara_journal *j)
 	const int log2_cpb = j->nand->log2_ppb - j->log2_ppc;
 	const dhara_page_t good_cps = good_blocks << log2_cpb;
 
-	/* Good checkpoints * (checkpoint period - 1) */
-	return (good_cps << j->log2_ppc) - good_cps;
+	/* Good checkpoints * (checkpoint period - metadata pages) */
+	return (good_cps << j->log2_ppc) - good_cps * j->meta_pages;
 }
 
 dhara_page_t dhara_journal_size(const struct dhara_journal *j)
@@ -500,35 +708,92 @@ dhara_page_t dhara_journal_size(const struct dhara_journal *j)
 	num_pages -= j->tail_sync;
 	num_cps -= j->tail_sync >> j->log2_ppc;
 
-	return num_pages - num_cps;
+	return num_pages - num_cps * j->meta_pages;
 }
 
 int dhara_journal_read_meta(struct dhara_journal *j, dhara_page_t p,
 			    uint8_t *buf, dhara_error_t *err)
 {
-	/* Offset of metadata within the metadata page */
-	const dhara_page_t ppc_mask = (1 << j->log2_ppc) - 1;
-	const size_t offset = hdr_user_offset(p & ppc_mask);
+#ifndef DHARA_NAND_OOB
+	/* Offset of metadata within the metadata buffer */
+	int which;
+	const size_t offset = meta_offset(j, p, &which);
 
 	/* Special case: buffered metadata */
 	if (align_eq(p, j->head, j->log2_ppc)) {
-		memcpy(buf, j->page_buf + offset, DHARA_META_SIZE);
+		memcpy(buf, j->page_buf +
+		       ((size_t)which << j->nand->log2_page_size) + offset,
+		       DHARA_META_SIZE);
 		return 0;
 	}
 
+#ifdef DHARA_NAND_CACHE_PROG
+	/* Special case: the checkpoint page is still being programmed,
+	 * and its contents are in the spare buffer.
+	 */
+	if ((j->flags & DHARA_JOURNAL_F_CP_PENDING) &&
+	    align_eq(p, j->pending, j->log2_ppc)) {
+		memcpy(buf, j->spare_buf +
+		       ((size_t)which << j->nand->log2_page_size) + offset,
+		       DHARA_META_SIZE);
+		return 0;
+	}
+#endif
+
 	/* Special case: incomplete metadata dumped at start of
 	 * recovery.
 	 */
 	if ((j->recover_meta != DHARA_PAGE_NONE) &&
 	    align_eq(p, j->recover_root, j->log2_ppc))
-		return dhara_nand_read(j->nand, j->recover_meta,
+		return dhara_nand_read(j->nand,
+				       phys_page(j, j->recover_meta + which),
 				       offset, DHARA_META_SIZE,
 				       buf, err);
+#endif
 
 	/* General case: fetch from metadata page for checkpoint group */
-	return dhara_nand_read(j->nand, p | ppc_mask,
-			       offset, DHARA_META_SIZE,
-			       buf, err);
+	return dhara_journal_read_cp_meta(j, p, buf, err);
+}
+
+int dhara_journal_summary(const struct dhara_journal *j, dhara_page_t p,
+			  uint8_t *buf)
+{
+	const uint8_t *s = j->page_buf + summary_offset(j);
+	size_t n = SUMMARY_HDR_SIZE;
+	int i;
+
+	if ((p == DHARA_PAGE_NONE) || (p != j->summary_root))
+		return -1;
+
+	for (i = 0; i < SUMMARY_WORDS; i++) {
+		uint8_t *w = buf + (i << 2);
+
+		if (s[4 + (i >> 3)] & (1 << (i & 7))) {
+			memcpy(w, s + n, 4);
+			n += 4;
+		} else {
+			memset(w, 0xff, 4);
+		}
+	}
+
+	return 0;
+}
+
+int dhara_journal_read_cp_meta(const struct dhara_journal *j,
+			       dhara_page_t p, uint8_t *buf,
+			       dhara_error_t *err)
+{
+#ifdef DHARA_NAND_OOB
+	/* Metadata was programmed with the page itself */
+	return dhara_nand_read_oob(j->nand, phys_page(j, p),
+				   0, DHARA_META_SIZE, buf, err);
+#else
+	int which;
+	const size_t offset = meta_offset(j, p, &which);
+
+	return dhara_nand_read(j->nand, phys_page(j, meta_page(j, p, which)),
+			       offset, DHARA_META_SIZE, buf, err);
+#endif
 }
 
 dhara_page_t dhara_journal_peek(struct dhara_journal *j)
@@ -542,7 +807,7 @@ dhara_page_t dhara_journal_peek(struct dhara_journal *j)
 
 		for (i = 0; i < DHARA_MAX_RETRIES; i++) {
 			if ((blk == (j->head >> j->nand->log2_ppb)) ||
-			    !dhara_nand_is_bad(j->nand, blk)) {
+			    !dhara_nand_is_bad(j->nand, phys_block(j, blk))) {
 				j->tail = blk << j->nand->log2_ppb;
 
 				if (j->tail == j->head)
@@ -591,8 +856,16 @@ void dhara_journal_clear(struct dhara_journal *j)
 	j->tail = j->head;
 	j->root = DHARA_PAGE_NONE;
 	j->flags |= DHARA_JOURNAL_F_DIRTY;
+	j->summary_root = DHARA_PAGE_NONE;
+
+	clear_user(j);
+}
 
-	hdr_clear_user(j->page_buf, j->nand->log2_page_size);
+/* Is the given block protected by the tail pin? */
+static inline int is_pinned(const struct dhara_journal *j, dhara_block_t blk)
+{
+	return (j->tail_pin != DHARA_PAGE_NONE) &&
+		((j->tail_pin >> j->nand->log2_ppb) == blk);
 }
 
 static int skip_block(struct dhara_journal *j, dhara_error_t *err)
@@ -600,8 +873,9 @@ static int skip_block(struct dhara_journal *j, dhara_error_t *err)
 	const dhara_block_t next = next_block(j->nand,
 		j->head >> j->nand->log2_ppb);
 
-	/* We can't roll onto the same block as the tail */
-	if ((j->tail_sync >> j->nand->log2_ppb) == next) {
+	/* We can't roll onto the same block as the tail (or the pin) */
+	if (((j->tail_sync >> j->nand->log2_ppb) == next) ||
+	    is_pinned(j, next)) {
 		dhara_set_error(err, DHARA_E_JOURNAL_FULL);
 		return -1;
 	}
@@ -613,6 +887,58 @@ static int skip_block(struct dhara_journal *j, dhara_error_t *err)
 	return 0;
 }
 
+#ifdef DHARA_NAND_MULTI_PLANE
+/* Can we erase the rest of the plane group starting at the given block
+ * along with it? They must all be good, and none may hold data that we
+ * still need.
+ */
+static int can_erase_group(const struct dhara_journal *j, dhara_block_t blk)
+{
+	const dhara_block_t tail_blk = j->tail_sync >> j->nand->log2_ppb;
+	int i;
+
+	for (i = 1; i < (1 << j->nand->log2_planes); i++) {
+		const dhara_block_t b = blk + i;
+
+		if ((b == tail_blk) || is_pinned(j, b) ||
+		    dhara_nand_is_bad(j->nand, phys_block(j, b)))
+			return 0;
+	}
+
+	return 1;
+}
+#endif
+
+/* Erase a block which the head is entering. At the start of a plane
+ * group, we try to erase the whole group at once. Subsequent blocks in
+ * the group then don't need erasing.
+ */
+static int erase_block(struct dhara_journal *j, dhara_block_t blk,
+		       dhara_error_t *err)
+{
+#ifdef DHARA_NAND_MULTI_PLANE
+	const uint8_t log2_planes = j->nand->log2_planes;
+
+	if ((blk >> log2_planes) == j->erased_group)
+		return 0;
+
+	j->erased_group = DHARA_BLOCK_NONE;
+
+	if (log2_planes && is_aligned(blk, log2_planes) &&
+	    can_erase_group(j, blk)) {
+		dhara_error_t my_err;
+
+		if (!dhara_nand_erase_multi(j->nand, phys_block(j, blk),
+					    &my_err)) {
+			j->erased_group = blk >> log2_planes;
+			return 0;
+		}
+	}
+#endif
+
+	return dhara_nand_erase(j->nand, phys_block(j, blk), err);
+}
+
 /* Make sure the head pointer is on a ready-to-program page. */
 static int prepare_head(struct dhara_journal *j, dhara_error_t *err)
 {
@@ -620,9 +946,10 @@ static int prepare_head(struct dhara_journal *j, dhara_error_t *err)
 	int i;
 
 	/* We can't write if doing so would cause the head pointer to
-	 * roll onto the same block as the last-synced tail.
+	 * roll onto the same block as the last-synced tail, or the pin.
 	 */
-	if (align_eq(next, j->tail_sync, j->nand->log2_ppb) &&
+	if ((align_eq(next, j->tail_sync, j->nand->log2_ppb) ||
+	     is_pinned(j, next >> j->nand->log2_ppb)) &&
 	    !align_eq(next, j->head, j->nand->log2_ppb)) {
 		dhara_set_error(err, DHARA_E_JOURNAL_FULL);
 		return -1;
@@ -635,8 +962,8 @@ static int prepare_head(struct dhara_journal *j, dhara_error_t *err)
 	for (i = 0; i < DHARA_MAX_RETRIES; i++) {
 		const dhara_block_t blk = j->head >> j->nand->log2_ppb;
 
-		if (!dhara_nand_is_bad(j->nand, blk))
-			return dhara_nand_erase(j->nand, blk, err);
+		if (!dhara_nand_is_bad(j->nand, phys_block(j, blk)))
+			return erase_block(j, blk, err);
 
 		j->bb_current++;
 		if (skip_block(j, err) < 0)
@@ -655,7 +982,8 @@ static void restart_recovery(struct dhara_journal *j, dhara_page_t old_head)
 	 */
 	if ((j->recover_meta == DHARA_PAGE_NONE) ||
 	    !align_eq(j->recover_meta, old_head, j->nand->log2_ppb))
-		dhara_nand_mark_bad(j->nand, old_head >> j->nand->log2_ppb);
+		dhara_nand_mark_bad(j->nand,
+			phys_block(j, old_head >> j->nand->log2_ppb));
 	else
 		j->flags |= DHARA_JOURNAL_F_BAD_META;
 
@@ -671,25 +999,40 @@ static void restart_recovery(struct dhara_journal *j, dhara_page_t old_head)
 	j->root = j->recover_root;
 }
 
+#ifndef DHARA_NAND_OOB
 static int dump_meta(struct dhara_journal *j, dhara_error_t *err)
 {
 	int i;
 
 	/* We've just begun recovery on a new erasable block, but we
-	 * have buffered metadata from the failed block.
+	 * have buffered metadata from the failed block. All pages of
+	 * the buffer are dumped, in order, at the start of the block.
 	 */
 	for (i = 0; i < DHARA_MAX_RETRIES; i++) {
 		dhara_error_t my_err;
+		dhara_page_t first = DHARA_PAGE_NONE;
+		int k;
+
+		/* Try to dump metadata on these pages */
+		for (k = 0; k < j->meta_pages; k++) {
+			if (prepare_head(j, &my_err) ||
+			    dhara_nand_prog(j->nand, phys_page(j, j->head),
+				j->page_buf +
+				((size_t)k << j->nand->log2_page_size),
+				&my_err))
+				break;
+
+			if (!k)
+				first = j->head;
 
-		/* Try to dump metadata on this page */
-		if (!(prepare_head(j, &my_err) ||
-		      dhara_nand_prog(j->nand, j->head,
-				      j->page_buf, &my_err))) {
-			j->recover_meta = j->head;
 			j->head = next_upage(j, j->head);
 			if (!j->head)
 				roll_stats(j);
-			hdr_clear_user(j->page_buf, j->nand->log2_page_size);
+		}
+
+		if (k >= j->meta_pages) {
+			j->recover_meta = first;
+			clear_user(j);
 			return 0;
 		}
 
@@ -700,7 +1043,8 @@ static int dump_meta(struct dhara_journal *j, dhara_error_t *err)
 		}
 
 		j->bb_current++;
-		dhara_nand_mark_bad(j->nand, j->head >> j->nand->log2_ppb);
+		dhara_nand_mark_bad(j->nand,
+			phys_block(j, j->head >> j->nand->log2_ppb));
 
 		if (skip_block(j, err) < 0)
 			return -1;
@@ -709,6 +1053,7 @@ static int dump_meta(struct dhara_journal *j, dhara_error_t *err)
 	dhara_set_error(err, DHARA_E_TOO_BAD);
 	return -1;
 }
+#endif
 
 static int recover_from(struct dhara_journal *j,
 			dhara_error_t write_err,
@@ -735,7 +1080,8 @@ static int recover_from(struct dhara_journal *j,
 
 	/* Were we block aligned? No recovery required! */
 	if (is_aligned(old_head, j->nand->log2_ppb)) {
-		dhara_nand_mark_bad(j->nand, old_head >> j->nand->log2_ppb);
+		dhara_nand_mark_bad(j->nand,
+			phys_block(j, old_head >> j->nand->log2_ppb));
 		return 0;
 	}
 
@@ -743,10 +1089,12 @@ static int recover_from(struct dhara_journal *j,
 	j->recover_next =
 		j->recover_root & ~((1 << j->nand->log2_ppb) - 1);
 
+#ifndef DHARA_NAND_OOB
 	/* Are we holding buffered metadata? Dump it first. */
 	if (!is_aligned(old_head, j->log2_ppc) &&
 	    dump_meta(j, err) < 0)
 		return -1;
+#endif
 
 	j->flags |= DHARA_JOURNAL_F_RECOVERY;
 	dhara_set_error(err, DHARA_E_RECOVER);
@@ -759,37 +1107,184 @@ static void finish_recovery(struct dhara_journal *j)
 	 * block as bad.
 	 */
 	dhara_nand_mark_bad(j->nand,
-		j->recover_root >> j->nand->log2_ppb);
+		phys_block(j, j->recover_root >> j->nand->log2_ppb));
 
 	/* If we had to dump metadata, and the page on which we
 	 * did this also went bad, mark it bad too.
 	 */
 	if (j->flags & DHARA_JOURNAL_F_BAD_META)
 		dhara_nand_mark_bad(j->nand,
-			j->recover_meta >> j->nand->log2_ppb);
+			phys_block(j, j->recover_meta >> j->nand->log2_ppb));
 
 	/* Was the tail on this page? Skip it forward */
 	clear_recovery(j);
 }
 
+#ifdef DHARA_NAND_CACHE_PROG
+/* Wait for the pending user page and the checkpoint page which follows
+ * it. Returns 0 if both were programmed successfully.
+ */
+static int wait_cached(struct dhara_journal *j, dhara_error_t *err)
+{
+	dhara_error_t cp_err;
+	int ret = dhara_nand_prog_complete(j->nand, err);
+
+	if ((dhara_nand_prog_complete(j->nand, &cp_err) < 0) && !ret) {
+		dhara_set_error(err, cp_err);
+		ret = -1;
+	}
+
+	return ret;
+}
+
+/* Swap the page buffer with the spare */
+static void swap_buffers(struct dhara_journal *j)
+{
+	uint8_t *tmp = j->page_buf;
+
+	j->page_buf = j->spare_buf;
+	j->spare_buf = tmp;
+}
+
+/* Program the checkpoint page while the last user page in the group is
+ * still being programmed. If we have a spare buffer, we can leave both
+ * outstanding: the old buffer is kept in case we need to undo the
+ * checkpoint, and the header and cookie carry over into the new one.
+ *
+ * Returns 0 on success, 1 if the user page was lost (and must be
+ * written again), or -1 if an error occurs.
+ */
+static int push_cached(struct dhara_journal *j, dhara_error_t *err)
+{
+	const dhara_page_t old_head = j->head;
+	dhara_error_t my_err;
+
+	dhara_nand_prog_submit(j->nand, phys_page(j, j->head + 1),
+			       j->page_buf);
+
+	if (!j->spare_buf) {
+		j->pending = DHARA_PAGE_NONE;
+
+		if (wait_cached(j, &my_err) < 0)
+			return recover_from(j, my_err, err) < 0 ? -1 : 1;
+
+		j->flags &= ~DHARA_JOURNAL_F_DIRTY;
+		j->root = old_head;
+		commit_summary(j, old_head);
+		j->head = next_upage(j, j->head);
+
+		if (!j->head)
+			roll_stats(j);
+
+		j->tail_sync = j->tail;
+		j->root_sync = j->root;
+		return 0;
+	}
+
+	j->cp_epoch = j->epoch;
+	j->cp_flags = j->flags;
+	j->cp_bb_current = j->bb_current;
+	j->cp_bb_last = j->bb_last;
+
+	swap_buffers(j);
+	memcpy(j->page_buf, j->spare_buf,
+	       DHARA_HEADER_SIZE + DHARA_COOKIE_SIZE);
+	memcpy(j->page_buf + summary_offset(j),
+	       j->spare_buf + summary_offset(j), summary_size(j));
+	commit_summary(j, old_head);
+
+	/* The synced tail and root aren't updated until the checkpoint
+	 * is known to be good.
+	 */
+	j->flags &= ~DHARA_JOURNAL_F_DIRTY;
+	j->flags |= DHARA_JOURNAL_F_CP_PENDING;
+	j->root = old_head;
+	j->head = next_upage(j, j->head);
+
+	if (!j->head)
+		roll_stats(j);
+
+	return 0;
+}
+#endif
+
+/* Summarize the root of the checkpoint we're about to write */
+static void put_summary(struct dhara_journal *j, dhara_page_t root,
+			const uint8_t *meta)
+{
+	const size_t size = summary_size(j);
+	uint8_t *s = j->page_buf + summary_offset(j);
+	size_t n = SUMMARY_HDR_SIZE;
+	int i;
+
+	j->summary_root = DHARA_PAGE_NONE;
+	if (!size)
+		return;
+
+	memset(s, 0xff, size);
+	memset(s + 4, 0, SUMMARY_MASK_SIZE);
+
+	for (i = 0; meta && (i < SUMMARY_WORDS); i++) {
+		const uint8_t *w = meta + (i << 2);
+
+		if (dhara_r32(w) == 0xffffffff)
+			continue;
+
+		if (n + 4 > size) {
+			memset(s, 0xff, size);
+			return;
+		}
+
+		s[4 + (i >> 3)] |= 1 << (i & 7);
+		memcpy(s + n, w, 4);
+		n += 4;
+	}
+
+	dhara_w32(s, root);
+}
+
+/* Program the metadata buffer: any extra pages first, and then the
+ * checkpoint page.
+ */
+static int prog_meta(struct dhara_journal *j, dhara_error_t *err)
+{
+	const uint8_t log2_page_size = j->nand->log2_page_size;
+	int i;
+
+	for (i = 1; i < j->meta_pages; i++)
+		if (dhara_nand_prog(j->nand, phys_page(j, j->head + i),
+				    j->page_buf + ((size_t)i << log2_page_size),
+				    err) < 0)
+			return -1;
+
+	return dhara_nand_prog(j->nand, phys_page(j, j->head + i),
+			       j->page_buf, err);
+}
+
 static int push_meta(struct dhara_journal *j, const uint8_t *meta,
 		     dhara_error_t *err)
 {
 	const dhara_page_t old_head = j->head;
 	dhara_error_t my_err;
-	const size_t offset =
-		hdr_user_offset(j->head & ((1 << j->log2_ppc) - 1));
+#ifndef DHARA_NAND_OOB
+	int which;
+	const size_t offset = meta_offset(j, j->head, &which);
+	uint8_t *slot = j->page_buf +
+		((size_t)which << j->nand->log2_page_size) + offset;
 
 	/* We've just written a user page. Add the metadata to the
-	 * buffer.
+	 * buffer. In OOB mode, it was programmed along with the page.
 	 */
 	if (meta)
-		memcpy(j->page_buf + offset, meta, DHARA_META_SIZE);
+		memcpy(slot, meta, DHARA_META_SIZE);
 	else
-		memset(j->page_buf + offset, 0xff, DHARA_META_SIZE);
+		memset(slot, 0xff, DHARA_META_SIZE);
+#else
+	(void)meta;
+#endif
 
 	/* Unless we've filled the buffer, don't do any IO */
-	if (!is_aligned(j->head + 2, j->log2_ppc)) {
+	if (!is_last_upage(j, j->head)) {
 		j->root = j->head;
 		j->head++;
 		return 0;
@@ -803,13 +1298,20 @@ static int push_meta(struct dhara_journal *j, const uint8_t *meta,
 	hdr_set_tail(j->page_buf, j->tail);
 	hdr_set_bb_current(j->page_buf, j->bb_current);
 	hdr_set_bb_last(j->page_buf, j->bb_last);
+	put_summary(j, old_head, meta);
 
-	if (dhara_nand_prog(j->nand, j->head + 1, j->page_buf, &my_err) < 0)
+#ifdef DHARA_NAND_CACHE_PROG
+	if (j->pending == j->head)
+		return push_cached(j, err);
+#endif
+
+	if (prog_meta(j, &my_err) < 0)
 		return recover_from(j, my_err, err);
 
 	j->flags &= ~DHARA_JOURNAL_F_DIRTY;
 
 	j->root = old_head;
+	commit_summary(j, old_head);
 	j->head = next_upage(j, j->head);
 
 	if (!j->head)
@@ -818,12 +1320,49 @@ static int push_meta(struct dhara_journal *j, const uint8_t *meta,
 	if (j->flags & DHARA_JOURNAL_F_ENUM_DONE)
 		finish_recovery(j);
 
-	if (!(j->flags & DHARA_JOURNAL_F_RECOVERY))
+	if (!(j->flags & DHARA_JOURNAL_F_RECOVERY)) {
 		j->tail_sync = j->tail;
+		j->root_sync = j->root;
+	}
 
 	return 0;
 }
 
+/* Program a user page at the head. In asynchronous mode, the operation
+ * is left outstanding, unless we are in recovery. Without cache-program
+ * support (or with more than one metadata page), the last user page in
+ * a group is also programmed synchronously, because the checkpoint page
+ * can't be programmed until it has finished.
+ *
+ * In OOB mode, the metadata is programmed into the page's spare area.
+ */
+static int prog_head(struct dhara_journal *j, const uint8_t *data,
+		     const uint8_t *meta, dhara_error_t *err)
+{
+#ifdef DHARA_NAND_ASYNC
+#ifdef DHARA_NAND_CACHE_PROG
+	if (!(((j->meta_pages > 1) && is_last_upage(j, j->head)) ||
+	      dhara_journal_in_recovery(j))) {
+#else
+	if (!(is_last_upage(j, j->head) ||
+	      dhara_journal_in_recovery(j))) {
+#endif
+		dhara_nand_prog_submit(j->nand, phys_page(j, j->head), data);
+		j->pending = j->head;
+		j->pending_root = j->root;
+		return 0;
+	}
+#endif
+
+#ifdef DHARA_NAND_OOB
+	return dhara_nand_prog_oob(j->nand, phys_page(j, j->head), data,
+				   meta, DHARA_META_SIZE, err);
+#else
+	(void)meta;
+	return dhara_nand_prog(j->nand, phys_page(j, j->head), data, err);
+#endif
+}
+
 int dhara_journal_enqueue(struct dhara_journal *j,
 			  const uint8_t *data, const uint8_t *meta,
 			  dhara_error_t *err)
@@ -833,9 +1372,17 @@ int dhara_journal_enqueue(struct dhara_journal *j,
 
 	for (i = 0; i < DHARA_MAX_RETRIES; i++) {
 		if (!(prepare_head(j, &my_err) ||
-		      (data && dhara_nand_prog(j->nand, j->head, data,
-					       &my_err))))
-			return push_meta(j, meta, err);
+		      (data && prog_head(j, data, meta, &my_err)))) {
+			const int ret = push_meta(j, meta, err);
+
+			/* A cached page may have been lost along with its
+			 * checkpoint. If so, try again.
+			 */
+			if (ret <= 0)
+				return ret;
+
+			continue;
+		}
 
 		if (recover_from(j, my_err, err) < 0)
 			return -1;
@@ -845,6 +1392,21 @@ int dhara_journal_enqueue(struct dhara_journal *j,
 	return -1;
 }
 
+/* Copy a page to the head, replacing its metadata in OOB mode */
+static int copy_head(struct dhara_journal *j, dhara_page_t p,
+		     const uint8_t *meta, dhara_error_t *err)
+{
+#ifdef DHARA_NAND_OOB
+	return dhara_nand_copy_oob(j->nand, phys_page(j, p),
+				   phys_page(j, j->head),
+				   meta, DHARA_META_SIZE, err);
+#else
+	(void)meta;
+	return dhara_nand_copy(j->nand, phys_page(j, p),
+			       phys_page(j, j->head), err);
+#endif
+}
+
 int dhara_journal_copy(struct dhara_journal *j,
 		       dhara_page_t p, const uint8_t *meta,
 		       dhara_error_t *err)
@@ -854,7 +1416,7 @@ int dhara_journal_copy(struct dhara_journal *j,
 
 	for (i = 0; i < DHARA_MAX_RETRIES; i++) {
 		if (!(prepare_head(j, &my_err) ||
-		      dhara_nand_copy(j->nand, p, j->head, &my_err)))
+		      copy_head(j, p, meta, &my_err)))
 			return push_meta(j, meta, err);
 
 		if (recover_from(j, my_err, err) < 0)
@@ -865,6 +1427,69 @@ int dhara_journal_copy(struct dhara_journal *j,
 	return -1;
 }
 
+#ifdef DHARA_NAND_ASYNC
+/* Wait for the pending user page, and the checkpoint page following it
+ * if that's also outstanding. If either failed, the checkpoint is
+ * undone.
+ */
+static int wait_pending(struct dhara_journal *j, dhara_error_t *err)
+{
+#ifdef DHARA_NAND_CACHE_PROG
+	if (j->flags & DHARA_JOURNAL_F_CP_PENDING) {
+		j->flags &= ~DHARA_JOURNAL_F_CP_PENDING;
+
+		if (!wait_cached(j, err)) {
+			j->tail_sync = j->tail;
+			j->root_sync = j->root;
+			return 0;
+		}
+
+		swap_buffers(j);
+		j->summary_root = DHARA_PAGE_NONE;
+		j->epoch = j->cp_epoch;
+		j->flags = j->cp_flags;
+		j->bb_current = j->cp_bb_current;
+		j->bb_last = j->cp_bb_last;
+		return -1;
+	}
+#endif
+
+	return dhara_nand_prog_complete(j->nand, err);
+}
+#endif
+
+int dhara_journal_complete(struct dhara_journal *j, dhara_error_t *err)
+{
+#ifdef DHARA_NAND_ASYNC
+	const dhara_page_t p = j->pending;
+	dhara_error_t my_err;
+
+	if (p == DHARA_PAGE_NONE)
+		return 0;
+
+	j->pending = DHARA_PAGE_NONE;
+	if (!wait_pending(j, &my_err))
+		return 0;
+
+	/* Take the page back off the front of the journal. If it was the
+	 * last in its group, the checkpoint has been undone. Either way,
+	 * we can proceed as though it failed synchronously.
+	 */
+	j->head = p;
+	j->root = j->pending_root;
+
+	if (recover_from(j, my_err, err) < 0)
+		return -1;
+
+	return 1;
+#else
+	(void)j;
+	(void)err;
+
+	return 0;
+#endif
+}
+
 dhara_page_t dhara_journal_next_recoverable(struct dhara_journal *j)
 {
 	const dhara_page_t n = j->recover_next;
@@ -50,6 +50,7 @@
 #define DHARA_JOURNAL_F_BAD_META	0x02
 #define DHARA_JOURNAL_F_RECOVERY	0x04
 #define DHARA_JOURNAL_F_ENUM_DONE	0x08
+#define DHARA_JOURNAL_F_CP_PENDING	0x10
 
 /* The journal layer presents the NAND pages as a double-ended queue.
  * Pages, with associated metadata may be pushed onto the end of the
@@ -74,8 +75,16 @@ struct dhara_journal {
 	 * The last page of each checkpoint contains the journal header
 	 * and the metadata for the other pages in the period (the user
 	 * pages).
+	 *
+	 * If built with DHARA_NAND_OOB, the metadata for each user page
+	 * is stored in its spare area instead. The checkpoint page then
+	 * holds only the header, and there's one per block.
+	 *
+	 * Otherwise, the metadata may span the last meta_pages pages of
+	 * the group (see dhara_journal_set_meta_buf()).
 	 */
 	uint8_t				log2_ppc;
+	uint8_t				meta_pages;
 
 	/* Epoch counter. This is incremented whenever the journal head
 	 * passes the end of the chip and wraps around.
@@ -104,6 +113,17 @@ struct dhara_journal {
 	/* This points to the last written user page in the journal */
 	dhara_page_t			root;
 
+	/* The root as of the last checkpoint, outside of recovery. All
+	 * metadata reachable from this page is stored in flash.
+	 */
+	dhara_page_t			root_sync;
+
+	/* If not PAGE_NONE, the head may not advance onto the block
+	 * containing this page. This allows a higher layer to protect
+	 * pages which have been dequeued but are still being read.
+	 */
+	dhara_page_t			tail_pin;
+
 	/* Recovery mode: recover_root points to the last valid user
 	 * page in the block requiring recovery. recover_next points to
 	 * the next user page needing recovery.
@@ -116,6 +136,43 @@ struct dhara_journal {
 	dhara_page_t			recover_next;
 	dhara_page_t			recover_root;
 	dhara_page_t			recover_meta;
+
+	/* Asynchronous mode: a user page whose program operation has
+	 * been submitted but not yet completed, and the root prior to
+	 * that page.
+	 */
+	dhara_page_t			pending;
+	dhara_page_t			pending_root;
+
+	/* Cache-program mode: if a spare page buffer is supplied, the
+	 * checkpoint page following a pending user page may also be left
+	 * outstanding (F_CP_PENDING). The buffers are exchanged, and the
+	 * state prior to the checkpoint is kept here so that it can be
+	 * undone if the program fails.
+	 */
+	uint8_t				*spare_buf;
+	uint8_t				cp_epoch;
+	uint8_t				cp_flags;
+	dhara_block_t			cp_bb_current;
+	dhara_block_t			cp_bb_last;
+
+	/* If not PAGE_NONE, the page buffer holds a summary of this
+	 * page's metadata, from the last checkpoint (see
+	 * dhara_journal_summary()).
+	 */
+	dhara_page_t			summary_root;
+
+	/* Multi-plane mode: if not BLOCK_NONE, the blocks following the
+	 * first in this plane group (journal block number divided by the
+	 * number of planes) have already been erased.
+	 */
+	dhara_block_t			erased_group;
+
+	/* Number of NAND operations performed by the most recent call
+	 * to dhara_journal_resume(). This is for diagnostic purposes
+	 * only.
+	 */
+	unsigned int			resume_ops;
 };
 
 /* Initialize a journal. You must supply a pointer to a NAND chip
@@ -123,9 +180,12 @@ struct dhara_journal {
  * exclusively by the journal, but you are responsible for allocating
  * it, and freeing it (if necessary) at the end.
  *
- * No NAND operations are performed at this point.
+ * No NAND operations are performed at this point. Returns 0, or -1 if
+ * the geometry described by the NAND driver doesn't divide evenly into
+ * plane groups (see struct dhara_nand), in which case the journal must
+ * not be used.
  */
-void dhara_journal_init(struct dhara_journal *j,
+int dhara_journal_init(struct dhara_journal *j,
 			const struct dhara_nand *n,
 			uint8_t *page_buf);
 
@@ -163,6 +223,35 @@ static inline dhara_page_t dhara_journal_root(const struct dhara_journal *j)
 	return j->root;
 }
 
+/* Obtain the root as of the last checkpoint */
+static inline dhara_page_t
+dhara_journal_root_sync(const struct dhara_journal *j)
+{
+	return j->root_sync;
+}
+
+/* Asynchronous mode: obtain the user page whose program is still
+ * outstanding (PAGE_NONE if there isn't one), and the root prior to it.
+ */
+static inline dhara_page_t
+dhara_journal_pending(const struct dhara_journal *j)
+{
+	return j->pending;
+}
+
+static inline dhara_page_t
+dhara_journal_pending_root(const struct dhara_journal *j)
+{
+	return j->pending_root;
+}
+
+/* Set or clear (with PAGE_NONE) the tail pin */
+static inline void dhara_journal_set_pin(struct dhara_journal *j,
+					 dhara_page_t p)
+{
+	j->tail_pin = p;
+}
+
 /* Read metadata associated with a page. This assumes that the page
  * provided is a valid data page. The actual page data is read via the
  * normal NAND interface.
@@ -170,6 +259,28 @@ static inline dhara_page_t dhara_journal_root(const struct dhara_journal *j)
 int dhara_journal_read_meta(struct dhara_journal *j, dhara_page_t p,
 			    uint8_t *buf, dhara_error_t *err);
 
+/* Read metadata associated with a page in a checkpointed group. This
+ * never consults the journal's buffers or any other mutable state, so
+ * it may be called concurrently with other journal operations
+ * (provided that the NAND driver allows it).
+ */
+int dhara_journal_read_cp_meta(const struct dhara_journal *j,
+			       dhara_page_t p, uint8_t *buf,
+			       dhara_error_t *err);
+
+/* Checkpoint summaries. Space left over on the checkpoint page, after
+ * the user metadata, holds a compact copy of the checkpoint root's
+ * metadata (erased words are omitted), if it fits. This stays in the
+ * page buffer until the next checkpoint, and is restored on resume, so
+ * the root's metadata can often be obtained without reading it.
+ * Readers which don't know about summaries ignore the slack space.
+ *
+ * If a summary of page p is held, this fills buf with its metadata and
+ * returns 0. Otherwise, it returns -1.
+ */
+int dhara_journal_summary(const struct dhara_journal *j, dhara_page_t p,
+			  uint8_t *buf);
+
 /* Advance the tail to the next non-bad block and return the page that's
  * ready to read. If no page is ready, return DHARA_PAGE_NONE.
  */
@@ -196,6 +307,9 @@ void dhara_journal_clear(struct dhara_journal *j);
  * This operation may be used as part of a recovery. If further errors
  * occur during recovery, E_RECOVER is returned, and the procedure must
  * be restarted.
+ *
+ * If data is NULL, the page is left unprogrammed. In OOB mode, any
+ * metadata given with it is then lost.
  */
 int dhara_journal_enqueue(struct dhara_journal *j,
 			  const uint8_t *data, const uint8_t *meta,
@@ -217,6 +331,48 @@ int dhara_journal_copy(struct dhara_journal *j,
 		       dhara_page_t p, const uint8_t *meta,
 		       dhara_error_t *err);
 
+/* Supply a larger metadata buffer, of the given number of pages, to
+ * replace the one given to dhara_journal_init(). Metadata for each
+ * checkpoint group is then spread over that many pages at the end of
+ * the group, allowing a longer checkpoint period. On chips with large
+ * pages, this reduces the fraction of pages given over to metadata
+ * (for example, three 4 kB metadata pages serve 61 user pages, rather
+ * than one serving 15).
+ *
+ * The number of pages may be reduced, so that each group has more user
+ * pages than metadata pages. It has no effect in DHARA_NAND_OOB mode.
+ * Call this after initialization, and before resuming. The same number
+ * of pages must be given every time the journal is resumed.
+ */
+void dhara_journal_set_meta_buf(struct dhara_journal *j, uint8_t *buf,
+				uint8_t pages);
+
+/* Supply a spare page buffer, for use in cache-program mode
+ * (DHARA_NAND_CACHE_PROG). This allows checkpoint pages to be left
+ * outstanding along with the user page that precedes them. The journal
+ * may exchange the spare buffer with the one given to
+ * dhara_journal_init(), so both must remain allocated. Call this after
+ * initialization.
+ */
+static inline void dhara_journal_set_spare_buf(struct dhara_journal *j,
+					       uint8_t *buf)
+{
+	j->spare_buf = buf;
+}
+
+/* Finish any outstanding program operation. This is only required when
+ * built with DHARA_NAND_ASYNC, in which case dhara_journal_enqueue() may
+ * return with the program of a user page still in progress. This must
+ * be called before any other journal operation.
+ *
+ * Returns 0 if nothing was outstanding, or if the operation succeeded.
+ * If it failed, the page is removed from the journal and must be
+ * enqueued again. In that case, 1 is returned if the journal is ready
+ * to accept it. Otherwise, -1 is returned, and the error code is
+ * E_RECOVER if recovery must be completed first.
+ */
+int dhara_journal_complete(struct dhara_journal *j, dhara_error_t *err);
+
 /* Mark the journal dirty. */
 static inline void dhara_journal_mark_dirty(struct dhara_journal *j)
 {
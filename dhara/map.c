@@ -68,18 +68,28 @@ static inline void meta_set_alt(uint8_t *meta, int level, dhara_page_t alt)
  * Public interface
  */
 
-void dhara_map_init(struct dhara_map *m, const struct dhara_nand *n,
-		    uint8_t *page_buf, uint8_t gc_ratio)
+int dhara_map_init(struct dhara_map *m, const struct dhara_nand *n,
+		   uint8_t *page_buf, uint8_t gc_ratio)
 {
 	if (!gc_ratio)
 		gc_ratio = 1;
 
-	dhara_journal_init(&m->journal, n, page_buf);
 	m->gc_ratio = gc_ratio;
+	m->snapshots = NULL;
+	m->readers = NULL;
+
+	return dhara_journal_init(&m->journal, n, page_buf);
 }
 
 int dhara_map_resume(struct dhara_map *m, dhara_error_t *err)
 {
+	if (dhara_map_complete(m, err) < 0)
+		return -1;
+
+	m->snapshots = NULL;
+	m->readers = NULL;
+	dhara_journal_set_pin(&m->journal, DHARA_PAGE_NONE);
+
 	if (dhara_journal_resume(&m->journal, err) < 0) {
 		m->count = 0;
 		return -1;
@@ -91,6 +101,17 @@ int dhara_map_resume(struct dhara_map *m, dhara_error_t *err)
 
 void dhara_map_clear(struct dhara_map *m)
 {
+	dhara_map_complete(m, NULL);
+
+	while (m->snapshots) {
+		struct dhara_map_snapshot *s = m->snapshots;
+
+		m->snapshots = s->next;
+		s->root = DHARA_PAGE_NONE;
+		s->count = 0;
+		s->next = NULL;
+	}
+
 	if (m->count) {
 		m->count = 0;
 		dhara_journal_clear(&m->journal);
@@ -110,7 +131,32 @@ dhara_sector_t dhara_map_capacity(const struct dhara_map *m)
 	return cap - reserve - safety_margin;
 }
 
-/* Trace the path from the root to the given sector, emitting
+/* Read metadata for a node in the tree. If synced is set, the node is
+ * known to be checkpointed, and we avoid touching any of the journal's
+ * mutable state.
+ */
+static int read_node(struct dhara_map *m, dhara_page_t p, int synced,
+		     uint8_t *meta, dhara_error_t *err)
+{
+	if (synced)
+		return dhara_journal_read_cp_meta(&m->journal, p, meta, err);
+
+	return dhara_journal_read_meta(&m->journal, p, meta, err);
+}
+
+/* Read metadata for the root of a trace. If the journal holds a
+ * summary of it, we don't need to touch the NAND.
+ */
+static int read_root(struct dhara_map *m, dhara_page_t p, int synced,
+		     uint8_t *meta, dhara_error_t *err)
+{
+	if (!synced && !dhara_journal_summary(&m->journal, p, meta))
+		return 0;
+
+	return read_node(m, p, synced, meta, err);
+}
+
+/* Trace the path from the given root to the given sector, emitting
  * alt-pointers and alt-full bits in the given metadata buffer. This
  * also returns the physical page containing the given sector, if it
  * exists.
@@ -119,13 +165,13 @@ dhara_sector_t dhara_map_capacity(const struct dhara_map *m)
  * (containing PAGE_NONE alt-pointers), and DHARA_E_NOT_FOUND will be
  * returned.
  */
-static int trace_path(struct dhara_map *m, dhara_sector_t target,
+static int trace_from(struct dhara_map *m, dhara_page_t p, int synced,
+		      dhara_sector_t target,
 		      dhara_page_t *loc, uint8_t *new_meta,
 		      dhara_error_t *err)
 {
 	uint8_t meta[DHARA_META_SIZE];
 	int depth = 0;
-	dhara_page_t p = dhara_journal_root(&m->journal);
 
 	if (new_meta)
 		meta_set_id(new_meta, target);
@@ -133,7 +179,7 @@ static int trace_path(struct dhara_map *m, dhara_sector_t target,
 	if (p == DHARA_PAGE_NONE)
 		goto not_found;
 
-	if (dhara_journal_read_meta(&m->journal, p, meta, err) < 0)
+	if (read_root(m, p, synced, meta, err) < 0)
 		return -1;
 
 	while (depth < DHARA_RADIX_DEPTH) {
@@ -152,8 +198,7 @@ static int trace_path(struct dhara_map *m, dhara_sector_t target,
 				goto not_found;
 			}
 
-			if (dhara_journal_read_meta(&m->journal, p,
-						    meta, err) < 0)
+			if (read_node(m, p, synced, meta, err) < 0)
 				return -1;
 		} else {
 			if (new_meta)
@@ -179,22 +224,96 @@ not_found:
 	return -1;
 }
 
+/* Trace the path from the current root */
+static int trace_path(struct dhara_map *m, dhara_sector_t target,
+		      dhara_page_t *loc, uint8_t *new_meta,
+		      dhara_error_t *err)
+{
+	return trace_from(m, dhara_journal_root(&m->journal), 0,
+			  target, loc, new_meta, err);
+}
+
 int dhara_map_find(struct dhara_map *m, dhara_sector_t target,
 		   dhara_page_t *loc, dhara_error_t *err)
 {
+	if (dhara_map_complete(m, err) < 0)
+		return -1;
+
 	return trace_path(m, target, loc, NULL, err);
 }
 
+/* Read a sector, starting from the given root */
+static int read_from(struct dhara_map *m, dhara_page_t root, int synced,
+		     dhara_sector_t s, uint8_t *data, dhara_error_t *err)
+{
+	const struct dhara_nand *n = m->journal.nand;
+	dhara_error_t my_err;
+	dhara_page_t p;
+
+	if (trace_from(m, root, synced, s, &p, NULL, &my_err) < 0) {
+		if (my_err == DHARA_E_NOT_FOUND) {
+			memset(data, 0xff, 1 << n->log2_page_size);
+			return 0;
+		}
+
+		dhara_set_error(err, my_err);
+		return -1;
+	}
+
+	return dhara_nand_read(n, dhara_nand_page_addr(n, p),
+			       0, 1 << n->log2_page_size, data, err);
+}
+
 int dhara_map_read(struct dhara_map *m, dhara_sector_t s,
 		   uint8_t *data, dhara_error_t *err)
+{
+	if (dhara_map_complete(m, err) < 0)
+		return -1;
+
+	return read_from(m, dhara_journal_root(&m->journal), 0, s, data, err);
+}
+
+/* Trace a path without waiting for an outstanding write. Only the most
+ * recent write can be in progress, and only its own sector's path
+ * passes through the pending page. Any other sector is traced from the
+ * root prior to it, so that the pending page is never read.
+ */
+static int trace_nowait(struct dhara_map *m, dhara_sector_t target,
+			dhara_page_t *loc, dhara_error_t *err)
+{
+	const dhara_page_t pending = dhara_journal_pending(&m->journal);
+
+	if (pending == DHARA_PAGE_NONE)
+		return trace_path(m, target, loc, NULL, err);
+
+	if (target == m->last_sector) {
+		if (loc)
+			*loc = pending;
+
+		return 0;
+	}
+
+	return trace_from(m, dhara_journal_pending_root(&m->journal), 0,
+			  target, loc, NULL, err);
+}
+
+int dhara_map_find_nowait(struct dhara_map *m, dhara_sector_t target,
+			  dhara_page_t *loc, dhara_error_t *err)
+{
+	return trace_nowait(m, target, loc, err);
+}
+
+int dhara_map_read_nowait(struct dhara_map *m, dhara_sector_t s,
+			  uint8_t *data, dhara_error_t *err)
 {
 	const struct dhara_nand *n = m->journal.nand;
+	const size_t page_size = 1 << n->log2_page_size;
 	dhara_error_t my_err;
 	dhara_page_t p;
 
-	if (dhara_map_find(m, s, &p, &my_err) < 0) {
+	if (trace_nowait(m, s, &p, &my_err) < 0) {
 		if (my_err == DHARA_E_NOT_FOUND) {
-			memset(data, 0xff, 1 << n->log2_page_size);
+			memset(data, 0xff, page_size);
 			return 0;
 		}
 
@@ -202,14 +321,53 @@ int dhara_map_read(struct dhara_map *m, dhara_sector_t s,
 		return -1;
 	}
 
-	return dhara_nand_read(n, p, 0, 1 << n->log2_page_size, data, err);
+	/* Data still being programmed is in the caller's buffer */
+	if (p == dhara_journal_pending(&m->journal)) {
+		memcpy(data, m->last_data, page_size);
+		return 0;
+	}
+
+	return dhara_nand_read(n, dhara_nand_page_addr(n, p),
+			       0, page_size, data, err);
+}
+
+/* Is the given page, which holds data for the given sector, reachable
+ * from any of the snapshot roots? Returns 1 if so, 0 if not, or -1 if
+ * an error occurs.
+ */
+static int is_pinned(struct dhara_map *m, dhara_page_t p,
+		     dhara_sector_t target, dhara_error_t *err)
+{
+	const struct dhara_map_snapshot *s;
+
+	for (s = m->snapshots; s; s = s->next) {
+		dhara_error_t my_err;
+		dhara_page_t loc;
+
+		if (trace_from(m, s->root, 0, target,
+			       &loc, NULL, &my_err) < 0) {
+			if (my_err == DHARA_E_NOT_FOUND)
+				continue;
+
+			dhara_set_error(err, my_err);
+			return -1;
+		}
+
+		if (loc == p)
+			return 1;
+	}
+
+	return 0;
 }
 
 /* Check the given page. If it's garbage, do nothing. Otherwise, rewrite
  * it at the front of the map. Return raw errors from the journal (do
  * not perform recovery).
+ *
+ * If check_pins is set and the page is reachable from a snapshot, do
+ * nothing and return 1. The page must not be dequeued.
  */
-static int raw_gc(struct dhara_map *m, dhara_page_t src,
+static int raw_gc(struct dhara_map *m, dhara_page_t src, int check_pins,
 		  dhara_error_t *err)
 {
 	dhara_sector_t target;
@@ -225,6 +383,13 @@ static int raw_gc(struct dhara_map *m, dhara_page_t src,
 	if (target == DHARA_SECTOR_NONE)
 		return 0;
 
+	if (check_pins) {
+		const int r = is_pinned(m, src, target, err);
+
+		if (r)
+			return r;
+	}
+
 	/* Find out where the sector once represented by this page
 	 * currently resides (if anywhere).
 	 */
@@ -266,6 +431,38 @@ static int pad_queue(struct dhara_map *m, dhara_error_t *err)
 	return dhara_journal_copy(&m->journal, p, root_meta, err);
 }
 
+/* Recover one page from the block being recovered. The restart count
+ * is incremented each time recovery has to start again.
+ */
+static int recover_step(struct dhara_map *m, int *restart_count,
+			dhara_error_t *err)
+{
+	dhara_page_t p = dhara_journal_next_recoverable(&m->journal);
+	dhara_error_t my_err;
+	int ret;
+
+	if (p == DHARA_PAGE_NONE)
+		ret = pad_queue(m, &my_err);
+	else
+		ret = raw_gc(m, p, 0, &my_err);
+
+	if (ret < 0) {
+		if (my_err != DHARA_E_RECOVER) {
+			dhara_set_error(err, my_err);
+			return -1;
+		}
+
+		if (*restart_count >= DHARA_MAX_RETRIES) {
+			dhara_set_error(err, DHARA_E_TOO_BAD);
+			return -1;
+		}
+
+		(*restart_count)++;
+	}
+
+	return 0;
+}
+
 /* Attempt to recover the journal */
 static int try_recover(struct dhara_map *m, dhara_error_t cause,
 		       dhara_error_t *err)
@@ -277,39 +474,46 @@ static int try_recover(struct dhara_map *m, dhara_error_t cause,
 		return -1;
 	}
 
-	while (dhara_journal_in_recovery(&m->journal)) {
-		dhara_page_t p = dhara_journal_next_recoverable(&m->journal);
-		dhara_error_t my_err;
-		int ret;
+	while (dhara_journal_in_recovery(&m->journal))
+		if (recover_step(m, &restart_count, err) < 0)
+			return -1;
 
-		if (p == DHARA_PAGE_NONE)
-			ret = pad_queue(m, &my_err);
-		else
-			ret = raw_gc(m, p, &my_err);
+	return 0;
+}
 
-		if (ret < 0) {
-			if (my_err != DHARA_E_RECOVER) {
-				dhara_set_error(err, my_err);
-				return -1;
-			}
+/* Collect the page at the tail, if possible. Return raw errors from
+ * the journal (do not perform recovery).
+ */
+static int gc_step(struct dhara_map *m, dhara_error_t *err)
+{
+	const dhara_page_t tail = dhara_journal_peek(&m->journal);
+	int ret;
 
-			if (restart_count >= DHARA_MAX_RETRIES) {
-				dhara_set_error(err, DHARA_E_TOO_BAD);
-				return -1;
-			}
+	if (tail == DHARA_PAGE_NONE)
+		return 0;
 
-			restart_count++;
-		}
-	}
+	ret = raw_gc(m, tail, 1, err);
+	if (ret < 0)
+		return -1;
+
+	/* If it's pinned by a snapshot, no progress is possible */
+	if (!ret)
+		dhara_journal_dequeue(&m->journal);
 
 	return 0;
 }
 
+/* Should writes be preceded by garbage collection? */
+static int need_gc(const struct dhara_map *m)
+{
+	return dhara_journal_size(&m->journal) >= dhara_map_capacity(m);
+}
+
 static int auto_gc(struct dhara_map *m, dhara_error_t *err)
 {
 	int i;
 
-	if (dhara_journal_size(&m->journal) < dhara_map_capacity(m))
+	if (!need_gc(m))
 		return 0;
 
 	for (i = 0; i <= m->gc_ratio; i++)
@@ -319,14 +523,14 @@ static int auto_gc(struct dhara_map *m, dhara_error_t *err)
 	return 0;
 }
 
-static int prepare_write(struct dhara_map *m, dhara_sector_t dst,
-			 uint8_t *meta, dhara_error_t *err)
+/* Prepare metadata for a new page holding the given sector, and update
+ * the sector count.
+ */
+static int prepare_meta(struct dhara_map *m, dhara_sector_t dst,
+			uint8_t *meta, dhara_error_t *err)
 {
 	dhara_error_t my_err;
 
-	if (auto_gc(m, err) < 0)
-		return -1;
-
 	if (trace_path(m, dst, NULL, meta, &my_err) < 0) {
 		if (my_err != DHARA_E_NOT_FOUND) {
 			dhara_set_error(err, my_err);
@@ -345,32 +549,181 @@ static int prepare_write(struct dhara_map *m, dhara_sector_t dst,
 	return 0;
 }
 
-int dhara_map_write(struct dhara_map *m, dhara_sector_t dst,
-		    const uint8_t *data, dhara_error_t *err)
+static int prepare_write(struct dhara_map *m, dhara_sector_t dst,
+			 uint8_t *meta, dhara_error_t *err)
 {
-	for (;;) {
-		uint8_t meta[DHARA_META_SIZE];
-		dhara_error_t my_err;
-		const dhara_sector_t old_count = m->count;
+	if (auto_gc(m, err) < 0)
+		return -1;
 
-		if (prepare_write(m, dst, meta, err) < 0)
+	return prepare_meta(m, dst, meta, err);
+}
+
+/* Step-wise write states */
+#define WRITE_COMPLETE		0
+#define WRITE_PLAN		1
+#define WRITE_GC		2
+#define WRITE_RECOVER		3
+#define WRITE_ENQUEUE		4
+#define WRITE_DONE		5
+
+/* Enter recovery, if the given error calls for it */
+static int write_recover(struct dhara_map_write_op *op, dhara_error_t cause,
+			 dhara_error_t *err)
+{
+	if (cause != DHARA_E_RECOVER) {
+		dhara_set_error(err, cause);
+		return -1;
+	}
+
+	op->state = WRITE_RECOVER;
+	op->restart_count = 0;
+	return 1;
+}
+
+static int write_step(struct dhara_map *m, struct dhara_map_write_op *op,
+		      dhara_error_t *err)
+{
+	uint8_t meta[DHARA_META_SIZE];
+	dhara_sector_t old_count;
+	dhara_error_t my_err;
+
+	switch (op->state) {
+	case WRITE_COMPLETE:
+		/* This can't be put off until the enqueue: planning and
+		 * preparing metadata may both need to read from the chip.
+		 */
+		if (dhara_map_complete(m, err) < 0)
 			return -1;
 
-		if (!dhara_journal_enqueue(&m->journal, data, meta, &my_err))
+		/* Fall through */
+	case WRITE_PLAN:
+		op->gc_left = need_gc(m) ? m->gc_ratio + 1 : 0;
+		op->state = WRITE_GC;
+
+		/* Fall through */
+	case WRITE_GC:
+		if (op->gc_left && (m->count || m->snapshots)) {
+			op->gc_left--;
+			if (gc_step(m, &my_err) < 0)
+				return write_recover(op, my_err, err);
+
+			return 1;
+		}
+
+		op->state = WRITE_ENQUEUE;
+		return 1;
+
+	case WRITE_RECOVER:
+		if (dhara_journal_in_recovery(&m->journal)) {
+			if (recover_step(m, &op->restart_count, err) < 0)
+				return -1;
+
+			return 1;
+		}
+
+		op->state = WRITE_PLAN;
+		return 1;
+
+	case WRITE_ENQUEUE:
+		old_count = m->count;
+		if (prepare_meta(m, op->sector, meta, err) < 0)
+			return -1;
+
+		if (dhara_journal_enqueue(&m->journal, op->data,
+					  meta, &my_err) < 0) {
+			m->count = old_count;
+			return write_recover(op, my_err, err);
+		}
+
+		m->last_sector = op->sector;
+		m->last_data = op->data;
+		m->last_count = old_count;
+
+		op->state = WRITE_DONE;
+		return 0;
+	}
+
+	return 0;
+}
+
+void dhara_map_write_start(struct dhara_map *m, struct dhara_map_write_op *op,
+			   dhara_sector_t dst, const uint8_t *data)
+{
+	(void)m;
+
+	op->sector = dst;
+	op->data = data;
+	op->state = WRITE_COMPLETE;
+	op->gc_left = 0;
+	op->restart_count = 0;
+}
+
+int dhara_map_write_step(struct dhara_map *m, struct dhara_map_write_op *op,
+			 dhara_error_t *err)
+{
+	const int ret = write_step(m, op, err);
+
+	if (ret < 0)
+		op->state = WRITE_DONE;
+
+	return ret;
+}
+
+int dhara_map_write_finish(struct dhara_map *m, struct dhara_map_write_op *op,
+			   dhara_error_t *err)
+{
+	int ret;
+
+	do {
+		ret = dhara_map_write_step(m, op, err);
+	} while (ret > 0);
+
+	return ret;
+}
+
+int dhara_map_complete(struct dhara_map *m, dhara_error_t *err)
+{
+	for (;;) {
+		struct dhara_map_write_op op;
+		dhara_error_t my_err;
+		const int ret = dhara_journal_complete(&m->journal, &my_err);
+
+		if (!ret)
 			break;
 
-		m->count = old_count;
+		/* The last write was lost. Recover if necessary, and
+		 * repeat it.
+		 */
+		m->count = m->last_count;
 
-		if (try_recover(m, my_err, err) < 0)
+		if ((ret < 0) && (try_recover(m, my_err, err) < 0))
+			return -1;
+
+		dhara_map_write_start(m, &op, m->last_sector, m->last_data);
+		op.state = WRITE_PLAN;
+
+		if (dhara_map_write_finish(m, &op, err) < 0)
 			return -1;
 	}
 
 	return 0;
 }
 
+int dhara_map_write(struct dhara_map *m, dhara_sector_t dst,
+		    const uint8_t *data, dhara_error_t *err)
+{
+	struct dhara_map_write_op op;
+
+	dhara_map_write_start(m, &op, dst, data);
+	return dhara_map_write_finish(m, &op, err);
+}
+
 int dhara_map_copy_page(struct dhara_map *m, dhara_page_t src,
 			dhara_sector_t dst, dhara_error_t *err)
 {
+	if (dhara_map_complete(m, err) < 0)
+		return -1;
+
 	for (;;) {
 		uint8_t meta[DHARA_META_SIZE];
 		dhara_error_t my_err;
@@ -436,10 +789,21 @@ static int try_delete(struct dhara_map *m, dhara_sector_t s,
 		level--;
 	}
 
-	/* Special case: deletion of last sector */
+	/* Special case: deletion of last sector. If snapshots are held,
+	 * we can't discard the journal contents, so write a filler page
+	 * as the new (empty) root instead.
+	 */
 	if (level < 0) {
+		if (m->snapshots) {
+			ck_set_count(dhara_journal_cookie(&m->journal), 0);
+			if (dhara_journal_enqueue(&m->journal,
+						  NULL, NULL, err) < 0)
+				return -1;
+		} else {
+			dhara_journal_clear(&m->journal);
+		}
+
 		m->count = 0;
-		dhara_journal_clear(&m->journal);
 		return 0;
 	}
 
@@ -467,6 +831,9 @@ static int try_delete(struct dhara_map *m, dhara_sector_t s,
 
 int dhara_map_trim(struct dhara_map *m, dhara_sector_t s, dhara_error_t *err)
 {
+	if (dhara_map_complete(m, err) < 0)
+		return -1;
+
 	for (;;) {
 		dhara_error_t my_err;
 
@@ -485,6 +852,9 @@ int dhara_map_trim(struct dhara_map *m, dhara_sector_t s, dhara_error_t *err)
 
 int dhara_map_sync(struct dhara_map *m, dhara_error_t *err)
 {
+	if (dhara_map_complete(m, err) < 0)
+		return -1;
+
 	while (!dhara_journal_is_clean(&m->journal)) {
 		dhara_page_t p = dhara_journal_peek(&m->journal);
 		dhara_error_t my_err;
@@ -493,9 +863,11 @@ int dhara_map_sync(struct dhara_map *m, dhara_error_t *err)
 		if (p == DHARA_PAGE_NONE) {
 			ret = pad_queue(m, &my_err);
 		} else {
-			ret = raw_gc(m, p, &my_err);
+			ret = raw_gc(m, p, 1, &my_err);
 			if (!ret)
 				dhara_journal_dequeue(&m->journal);
+			else if (ret > 0)
+				ret = pad_queue(m, &my_err);
 		}
 
 		if ((ret < 0) && (try_recover(m, my_err, err) < 0))
@@ -507,24 +879,272 @@ int dhara_map_sync(struct dhara_map *m, dhara_error_t *err)
 
 int dhara_map_gc(struct dhara_map *m, dhara_error_t *err)
 {
-	if (!m->count)
+	if (dhara_map_complete(m, err) < 0)
+		return -1;
+
+	if (!(m->count || m->snapshots))
 		return 0;
 
 	for (;;) {
-		dhara_page_t tail = dhara_journal_peek(&m->journal);
 		dhara_error_t my_err;
 
-		if (tail == DHARA_PAGE_NONE)
+		if (!gc_step(m, &my_err))
 			break;
 
-		if (!raw_gc(m, tail, &my_err)) {
-			dhara_journal_dequeue(&m->journal);
-			break;
+		if (try_recover(m, my_err, err) < 0)
+			return -1;
+	}
+
+	return 0;
+}
+
+int dhara_map_snapshot_create(struct dhara_map *m,
+			      struct dhara_map_snapshot *s,
+			      dhara_error_t *err)
+{
+	/* Make sure the root and all metadata along its paths are
+	 * checkpointed before we pin it.
+	 */
+	if (dhara_map_sync(m, err) < 0)
+		return -1;
+
+	s->root = dhara_journal_root(&m->journal);
+	s->count = m->count;
+	s->next = m->snapshots;
+	m->snapshots = s;
+
+	return 0;
+}
+
+void dhara_map_snapshot_release(struct dhara_map *m,
+				struct dhara_map_snapshot *s)
+{
+	struct dhara_map_snapshot **p = &m->snapshots;
+
+	while (*p) {
+		if (*p == s) {
+			*p = s->next;
+			s->next = NULL;
+			return;
 		}
 
-		if (try_recover(m, my_err, err) < 0)
+		p = &(*p)->next;
+	}
+}
+
+/* A snapshot's pages were all checkpointed before it was taken, so
+ * there's no need to wait for an outstanding write.
+ */
+int dhara_map_snapshot_find(struct dhara_map *m,
+			    const struct dhara_map_snapshot *s,
+			    dhara_sector_t target, dhara_page_t *loc,
+			    dhara_error_t *err)
+{
+	return trace_from(m, s->root, 0, target, loc, NULL, err);
+}
+
+int dhara_map_snapshot_read(struct dhara_map *m,
+			    const struct dhara_map_snapshot *s,
+			    dhara_sector_t target, uint8_t *data,
+			    dhara_error_t *err)
+{
+	return read_from(m, s->root, 0, target, data, err);
+}
+
+/* A pair of subtrees awaiting comparison. Both cover the same prefix
+ * of the given depth. If one is DHARA_PAGE_NONE, every sector in the
+ * other is reported.
+ */
+struct diff_pair {
+	dhara_page_t	a;
+	dhara_page_t	b;
+	uint8_t		depth;
+};
+
+/* Pairs are pushed in order of increasing depth, and processing a pair
+ * pushes only deeper ones. Because at most two are pushed at any one
+ * depth, the stack never holds more than two pairs per level.
+ */
+#define DIFF_STACK_SIZE		(DHARA_RADIX_DEPTH * 2 + 1)
+
+static void diff_push(struct diff_pair *stack, int *top,
+		      dhara_page_t a, dhara_page_t b, int depth)
+{
+	if (a == b)
+		return;
+
+	stack[*top].a = a;
+	stack[*top].b = b;
+	stack[*top].depth = depth;
+	(*top)++;
+}
+
+/* Report every sector in the subtree formed by the given page and its
+ * alt-pointers at or below the given depth.
+ */
+static void diff_emit(struct diff_pair *stack, int *top,
+		      const uint8_t *meta, int depth,
+		      dhara_map_diff_func_t cb, void *arg)
+{
+	const dhara_sector_t id = meta_get_id(meta);
+
+	/* Filler pages form an empty tree */
+	if (id == DHARA_SECTOR_NONE)
+		return;
+
+	cb(arg, id);
+
+	while (depth < DHARA_RADIX_DEPTH) {
+		diff_push(stack, top, DHARA_PAGE_NONE,
+			  meta_get_alt(meta, depth), depth + 1);
+		depth++;
+	}
+}
+
+/* Compare two subtrees which cover the same prefix of the given depth.
+ * Identical pages mean identical subtrees, so we only descend where the
+ * alt-pointers differ.
+ */
+static void diff_walk(struct diff_pair *stack, int *top,
+		      const struct diff_pair *d,
+		      const uint8_t *meta_a, const uint8_t *meta_b,
+		      dhara_map_diff_func_t cb, void *arg)
+{
+	const dhara_sector_t id_a = meta_get_id(meta_a);
+	const dhara_sector_t id_b = meta_get_id(meta_b);
+	int depth = d->depth;
+
+	if (id_a == DHARA_SECTOR_NONE) {
+		diff_emit(stack, top, meta_b, depth, cb, arg);
+		return;
+	}
+
+	if (id_b == DHARA_SECTOR_NONE) {
+		diff_emit(stack, top, meta_a, depth, cb, arg);
+		return;
+	}
+
+	while (depth < DHARA_RADIX_DEPTH) {
+		const dhara_page_t alt_a = meta_get_alt(meta_a, depth);
+		const dhara_page_t alt_b = meta_get_alt(meta_b, depth);
+
+		/* If the two representative nodes go different ways at
+		 * this level, each one's half is compared against the
+		 * other's alt-pointer.
+		 */
+		if ((id_a ^ id_b) & d_bit(depth)) {
+			diff_push(stack, top, d->a, alt_b, depth + 1);
+			diff_push(stack, top, alt_a, d->b, depth + 1);
+			return;
+		}
+
+		diff_push(stack, top, alt_a, alt_b, depth + 1);
+		depth++;
+	}
+
+	/* Same sector, different pages */
+	cb(arg, id_a);
+}
+
+int dhara_map_diff(struct dhara_map *m,
+		   dhara_page_t old_root, dhara_page_t new_root,
+		   dhara_map_diff_func_t cb, void *arg,
+		   dhara_error_t *err)
+{
+	struct diff_pair stack[DIFF_STACK_SIZE];
+	int top = 0;
+
+	if (dhara_map_complete(m, err) < 0)
+		return -1;
+
+	diff_push(stack, &top, old_root, new_root, 0);
+
+	while (top) {
+		const struct diff_pair d = stack[--top];
+		uint8_t meta_a[DHARA_META_SIZE];
+		uint8_t meta_b[DHARA_META_SIZE];
+
+		if ((d.a != DHARA_PAGE_NONE) &&
+		    (dhara_journal_read_meta(&m->journal, d.a,
+					     meta_a, err) < 0))
+			return -1;
+
+		if ((d.b != DHARA_PAGE_NONE) &&
+		    (dhara_journal_read_meta(&m->journal, d.b,
+					     meta_b, err) < 0))
 			return -1;
+
+		if (d.a == DHARA_PAGE_NONE)
+			diff_emit(stack, &top, meta_b, d.depth, cb, arg);
+		else if (d.b == DHARA_PAGE_NONE)
+			diff_emit(stack, &top, meta_a, d.depth, cb, arg);
+		else
+			diff_walk(stack, &top, &d, meta_a, meta_b, cb, arg);
 	}
 
 	return 0;
 }
+
+/* Pin the journal at the watermark of the oldest reader. Readers are
+ * added at the head of the list, so this is the last one.
+ */
+static void update_pin(struct dhara_map *m)
+{
+	const struct dhara_map_reader *r = m->readers;
+
+	if (!r) {
+		dhara_journal_set_pin(&m->journal, DHARA_PAGE_NONE);
+		return;
+	}
+
+	while (r->next)
+		r = r->next;
+
+	dhara_journal_set_pin(&m->journal, r->watermark);
+}
+
+void dhara_map_reader_begin(struct dhara_map *m, struct dhara_map_reader *r)
+{
+	r->root = dhara_journal_root_sync(&m->journal);
+	r->watermark = m->journal.tail_sync;
+	r->next = m->readers;
+	m->readers = r;
+
+	update_pin(m);
+}
+
+void dhara_map_reader_end(struct dhara_map *m, struct dhara_map_reader *r)
+{
+	struct dhara_map_reader **p = &m->readers;
+
+	while (*p) {
+		if (*p == r) {
+			*p = r->next;
+			r->next = NULL;
+			break;
+		}
+
+		p = &(*p)->next;
+	}
+
+	update_pin(m);
+}
+
+/* Readers see only pages up to the last checkpoint. These have all been
+ * programmed, so there's no need to wait for an outstanding write.
+ */
+int dhara_map_reader_find(struct dhara_map *m,
+			  const struct dhara_map_reader *r,
+			  dhara_sector_t target, dhara_page_t *loc,
+			  dhara_error_t *err)
+{
+	return trace_from(m, r->root, 1, target, loc, NULL, err);
+}
+
+int dhara_map_reader_read(struct dhara_map *m,
+			  const struct dhara_map_reader *r,
+			  dhara_sector_t target, uint8_t *data,
+			  dhara_error_t *err)
+{
+	return read_from(m, r->root, 1, target, data, err);
+}
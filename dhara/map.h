@@ -27,11 +27,53 @@ typedef uint32_t dhara_sector_t;
 /* This sector value is reserved */
 #define DHARA_SECTOR_NONE	0xffffffff
 
+/* A snapshot is a pinned root of the map's radix tree. Because the
+ * tree is functional, an old root continues to describe a consistent
+ * image of the map as it was at the time the root was written.
+ *
+ * Snapshots are allocated by the caller, and are linked into the map
+ * while they are held. They are not persistent: they are discarded on
+ * resume.
+ */
+struct dhara_map_snapshot {
+	dhara_page_t			root;
+	dhara_sector_t			count;
+	struct dhara_map_snapshot	*next;
+};
+
+/* A concurrent reader. This captures the root as of the last
+ * checkpoint, together with the synchronized tail at that time (the
+ * watermark). All pages reachable from the root lie after the
+ * watermark, and the journal won't erase the block containing the
+ * watermark while the reader is registered.
+ *
+ * Readers are allocated by the caller and linked into the map while
+ * they are registered.
+ */
+struct dhara_map_reader {
+	dhara_page_t			root;
+	dhara_page_t			watermark;
+	struct dhara_map_reader		*next;
+};
+
 struct dhara_map {
-	struct dhara_journal	journal;
+	struct dhara_journal		journal;
+
+	uint8_t				gc_ratio;
+	dhara_sector_t			count;
+
+	/* List of currently held snapshots */
+	struct dhara_map_snapshot	*snapshots;
 
-	uint8_t			gc_ratio;
-	dhara_sector_t		count;
+	/* List of registered readers, newest first */
+	struct dhara_map_reader		*readers;
+
+	/* Asynchronous mode: the most recent write, which may still be
+	 * in progress, and the sector count prior to it.
+	 */
+	dhara_sector_t			last_sector;
+	const uint8_t			*last_data;
+	dhara_sector_t			last_count;
 };
 
 /* Initialize a map. You need to supply a buffer for page metadata, and
@@ -41,16 +83,24 @@ struct dhara_map {
  * Smaller values lead to faster and more predictable IO, at the
  * expense of capacity. You should always initialize the same chip with
  * the same garbage collection ratio.
+ *
+ * Returns 0, or -1 if the NAND geometry is unusable (see
+ * dhara_journal_init()).
  */
-void dhara_map_init(struct dhara_map *m, const struct dhara_nand *n,
-		    uint8_t *page_buf, uint8_t gc_ratio);
+int dhara_map_init(struct dhara_map *m, const struct dhara_nand *n,
+		   uint8_t *page_buf, uint8_t gc_ratio);
 
 /* Recover stored state, if possible. If there is no valid stored state
  * on the chip, -1 is returned, and an empty map is initialized.
+ *
+ * An outstanding write is completed first. If that fails, -1 is
+ * returned and the map is left as it was.
  */
 int dhara_map_resume(struct dhara_map *m, dhara_error_t *err);
 
-/* Clear the map (delete all sectors). */
+/* Clear the map (delete all sectors). Any snapshots held are released
+ * and become empty.
+ */
 void dhara_map_clear(struct dhara_map *m);
 
 /* Obtain the maximum capacity of the map. */
@@ -75,10 +125,72 @@ int dhara_map_find(struct dhara_map *m, dhara_sector_t s,
 int dhara_map_read(struct dhara_map *m, dhara_sector_t s,
 		   uint8_t *data, dhara_error_t *err);
 
+/* Lookups which don't wait for an outstanding write (see
+ * dhara_map_complete()). They don't modify the map, so several may run
+ * concurrently, provided that no other map operation runs at the same
+ * time (tsmap.h arranges this).
+ *
+ * If the most recent write is still being programmed, its sector is
+ * reported at the pending page, and its data is copied from the buffer
+ * passed to dhara_map_write(). The pending page itself is never read.
+ * Without DHARA_NAND_ASYNC, these are the same as dhara_map_find() and
+ * dhara_map_read().
+ */
+int dhara_map_find_nowait(struct dhara_map *m, dhara_sector_t s,
+			  dhara_page_t *loc, dhara_error_t *err);
+int dhara_map_read_nowait(struct dhara_map *m, dhara_sector_t s,
+			  uint8_t *data, dhara_error_t *err);
+
 /* Write data to a logical sector. */
 int dhara_map_write(struct dhara_map *m, dhara_sector_t s,
 		    const uint8_t *data, dhara_error_t *err);
 
+/* Step-wise writes. A write may involve an unbounded amount of work, if
+ * garbage collection or bad-block recovery is required. If you need to
+ * interleave other work, start the write with dhara_map_write_start()
+ * and then call dhara_map_write_step() until it returns 0 (done) or -1
+ * (error). A return value of 1 means that more steps are required.
+ *
+ * Each step garbage collects or recovers at most one page, or writes
+ * the new page itself. This involves at most one page program or copy,
+ * preceded by metadata reads along one path of the tree.
+ *
+ * dhara_map_write_finish() performs all remaining steps. Between steps,
+ * the map is consistent and reflects the state prior to the write, so
+ * you may call dhara_map_find() and dhara_map_read(). No other map
+ * operation may be performed while a write is in progress.
+ */
+struct dhara_map_write_op {
+	dhara_sector_t			sector;
+	const uint8_t			*data;
+
+	uint8_t				state;
+	unsigned int			gc_left;
+	int				restart_count;
+};
+
+void dhara_map_write_start(struct dhara_map *m, struct dhara_map_write_op *op,
+			   dhara_sector_t dst, const uint8_t *data);
+int dhara_map_write_step(struct dhara_map *m, struct dhara_map_write_op *op,
+			 dhara_error_t *err);
+int dhara_map_write_finish(struct dhara_map *m, struct dhara_map_write_op *op,
+			   dhara_error_t *err);
+
+/* Finish the most recent write. This is only required when built with
+ * DHARA_NAND_ASYNC, in which case dhara_map_write() may return while the
+ * page is still being programmed, and the data buffer passed to it must
+ * remain valid until the next map operation. If the program fails, the
+ * write is repeated.
+ *
+ * All other map operations do this implicitly, before any other work,
+ * except for the _nowait lookups and those made through readers and
+ * snapshots. The program overlaps only with what the caller does in
+ * between, and with those lookups.
+ * You need only call it if you want to release the buffer, or to find
+ * out whether the write succeeded, before doing anything else.
+ */
+int dhara_map_complete(struct dhara_map *m, dhara_error_t *err);
+
 /* Copy any flash page to a logical sector. */
 int dhara_map_copy_page(struct dhara_map *m, dhara_page_t src,
 			dhara_sector_t dst, dhara_error_t *err);
@@ -111,4 +223,104 @@ int dhara_map_sync(struct dhara_map *m, dhara_error_t *err);
  */
 int dhara_map_gc(struct dhara_map *m, dhara_error_t *err);
 
+/* Create a snapshot of the current state of the map. The map is
+ * synchronized first, and the current root is then pinned. Returns 0
+ * on success or -1 if an error occurs.
+ *
+ * While a snapshot is held, garbage collection treats every page
+ * reachable from its root as live. Pages can't be relocated without
+ * invalidating the snapshot, so the tail of the journal stops at the
+ * first such page. If you hold a snapshot for long enough, writes will
+ * eventually fail with E_JOURNAL_FULL.
+ */
+int dhara_map_snapshot_create(struct dhara_map *m,
+			      struct dhara_map_snapshot *s,
+			      dhara_error_t *err);
+
+/* Release a snapshot, allowing its pages to be garbage collected. */
+void dhara_map_snapshot_release(struct dhara_map *m,
+				struct dhara_map_snapshot *s);
+
+/* Obtain the number of allocated sectors in a snapshot. */
+static inline dhara_sector_t
+dhara_map_snapshot_size(const struct dhara_map_snapshot *s)
+{
+	return s->count;
+}
+
+/* Find the physical page which held the data for a sector at the time
+ * the snapshot was taken. If the sector didn't exist, the error is
+ * E_NOT_FOUND.
+ */
+int dhara_map_snapshot_find(struct dhara_map *m,
+			    const struct dhara_map_snapshot *s,
+			    dhara_sector_t target, dhara_page_t *loc,
+			    dhara_error_t *err);
+
+/* Read a logical sector as it was at the time the snapshot was taken.
+ * If the sector was unmapped, a blank page (0xff) will be returned.
+ *
+ * Snapshot lookups don't modify the map, and don't wait for an
+ * outstanding write, so they may run concurrently with the _nowait
+ * lookups.
+ */
+int dhara_map_snapshot_read(struct dhara_map *m,
+			    const struct dhara_map_snapshot *s,
+			    dhara_sector_t target, uint8_t *data,
+			    dhara_error_t *err);
+
+/* Enumerate the sectors whose mapping differs between two roots of the
+ * map. Roots may be taken from snapshots, or from the current state of
+ * the journal (dhara_journal_root()). Both roots must still be live:
+ * either pinned by a snapshot, or current.
+ *
+ * The given function is called once for each sector which is present
+ * in one map but not the other, or which is mapped to different pages.
+ * Sectors which have been relocated by garbage collection are reported
+ * too, even though their content is unchanged.
+ *
+ * Subtrees which are shared between the two roots are skipped, so the
+ * cost is proportional to the number of differences multiplied by the
+ * depth of the tree. The walk doesn't recurse: it needs about 1 kB of
+ * stack, for a fixed array of pending subtrees and two metadata
+ * buffers, however deep the tree is.
+ */
+typedef void (*dhara_map_diff_func_t)(void *arg, dhara_sector_t s);
+
+int dhara_map_diff(struct dhara_map *m,
+		   dhara_page_t old_root, dhara_page_t new_root,
+		   dhara_map_diff_func_t cb, void *arg,
+		   dhara_error_t *err);
+
+/* Concurrent reads. If you have a single writer and several readers,
+ * readers need only hold the writer's lock for the duration of
+ * dhara_map_reader_begin() and dhara_map_reader_end(). In between,
+ * dhara_map_reader_find() and dhara_map_reader_read() may be called
+ * without the lock, in parallel with any other map operation, provided
+ * that the NAND driver permits concurrent reads.
+ *
+ * When built with DHARA_NAND_ASYNC, a reader doesn't wait for an
+ * outstanding write, so its reads may reach the NAND driver while a
+ * program is in progress. They never target the page being programmed
+ * (see dhara_nand_prog_submit()).
+ *
+ * A reader sees the map as of the last checkpoint. While any reader is
+ * registered, the journal head can't advance onto the block containing
+ * the oldest reader's watermark. If readers are held for long enough,
+ * writes will eventually fail with E_JOURNAL_FULL.
+ */
+void dhara_map_reader_begin(struct dhara_map *m,
+			    struct dhara_map_reader *r);
+void dhara_map_reader_end(struct dhara_map *m,
+			  struct dhara_map_reader *r);
+
+int dhara_map_reader_find(struct dhara_map *m,
+			  const struct dhara_map_reader *r,
+			  dhara_sector_t target, dhara_page_t *loc,
+			  dhara_error_t *err);
+int dhara_map_reader_read(struct dhara_map *m,
+			  const struct dhara_map_reader *r,
+			  dhara_sector_t target, uint8_t *data,
+			  dhara_error_t *err);
+
 #endif
@@ -31,6 +31,11 @@ typedef uint32_t dhara_page_t;
 /* Blocks are also indexed, starting at 0. */
 typedef uint32_t dhara_block_t;
 
+/* This is a block number which can be used to represent "no such
+ * block".
+ */
+#define DHARA_BLOCK_NONE	((dhara_block_t)0xffffffff)
+
 /* Each NAND chip must be represented by one of these structures. It's
  * intended that this structure be embedded in a larger structure for
  * context.
@@ -51,8 +56,44 @@ struct dhara_nand {
 
 	/* Total number of eraseblocks */
 	unsigned int	num_blocks;
+
+	/* Base-2 logarithm of the number of planes per die. The plane of a
+	 * block is given by the low bits of its number, and num_blocks
+	 * must be a multiple of the number of planes (dhara_journal_init()
+	 * fails otherwise). Leave this as 0 if you don't want to use
+	 * multi-plane erase (see dhara_nand_erase_multi()).
+	 */
+	uint8_t		log2_planes;
+
+	/* Physical number of the first block. This is 0 for a whole
+	 * chip, but may be set so that a range of blocks can be presented
+	 * as a device in its own right (see part.h). It's added to every
+	 * translated block address.
+	 */
+	dhara_block_t	first_block;
 };
 
+/* These functions translate journal block and page numbers to the
+ * physical numbers passed to the functions below, by adding the
+ * offset of the first block. For a whole chip, they're the identity.
+ *
+ * Pages returned by the map (dhara_map_find()) are journal pages.
+ */
+static inline dhara_block_t
+dhara_nand_block_addr(const struct dhara_nand *n, dhara_block_t b)
+{
+	return n->first_block + b;
+}
+
+static inline dhara_page_t
+dhara_nand_page_addr(const struct dhara_nand *n, dhara_page_t p)
+{
+	const dhara_page_t offset = p & ((1 << n->log2_ppb) - 1);
+
+	return (dhara_nand_block_addr(n, p >> n->log2_ppb) << n->log2_ppb) |
+		offset;
+}
+
 /* Is the given block bad? */
 int dhara_nand_is_bad(const struct dhara_nand *n, dhara_block_t b);
 
@@ -102,4 +143,71 @@ int dhara_nand_copy(const struct dhara_nand *n,
 		    dhara_page_t src, dhara_page_t dst,
 		    dhara_error_t *err);
 
+/* Split-phase programming. These are required only if Dhara is built
+ * with DHARA_NAND_ASYNC.
+ *
+ * dhara_nand_prog_submit() transfers the page data and starts the
+ * program operation, but returns without waiting for it to finish. The
+ * data buffer may be reused as soon as it returns. The conditions for
+ * dhara_nand_prog() apply.
+ *
+ * dhara_nand_prog_complete() waits for the submitted operation to
+ * finish and reports its status, as for dhara_nand_prog().
+ *
+ * Erases are always synchronous. At most one operation is outstanding
+ * at a time, and no other NAND function is called by the journal until
+ * it has been completed. The exception is lookups which don't wait for
+ * it: those made through readers and snapshots, and the _nowait
+ * lookups (see map.h). They may call dhara_nand_read() or
+ * dhara_nand_read_oob() at any time, but never for a page which is
+ * still being programmed.
+ */
+void dhara_nand_prog_submit(const struct dhara_nand *n, dhara_page_t p,
+			    const uint8_t *data);
+int dhara_nand_prog_complete(const struct dhara_nand *n,
+			     dhara_error_t *err);
+
+/* Multi-plane erase. This is required only if Dhara is built with
+ * DHARA_NAND_MULTI_PLANE.
+ *
+ * Erase (1 << log2_planes) blocks, one on each plane of a die, starting
+ * at the given physical block (which is aligned). Return 0 if all were
+ * erased successfully. Otherwise, return -1 and set err as for
+ * dhara_nand_erase(). In that case, the journal falls back to erasing
+ * blocks individually to find out which one failed.
+ */
+int dhara_nand_erase_multi(const struct dhara_nand *n, dhara_block_t b,
+			   dhara_error_t *err);
+
+/* Out-of-band metadata. These are required only if Dhara is built with
+ * DHARA_NAND_OOB, in which case the journal stores the metadata record
+ * for each user page in that page's spare area, rather than collecting
+ * it on the checkpoint page. The spare area must have room for the
+ * record (DHARA_META_SIZE bytes) and it must be protected by ECC.
+ *
+ * dhara_nand_prog_oob() programs a page along with length bytes of
+ * spare data. If oob is NULL, the spare data is left erased (reading
+ * it back gives all 0xff). Otherwise, the conditions for
+ * dhara_nand_prog() apply.
+ *
+ * dhara_nand_read_oob() reads a portion of the spare data, as for
+ * dhara_nand_read(). For an unprogrammed page, or one programmed with
+ * dhara_nand_prog(), it must give all 0xff.
+ *
+ * dhara_nand_copy_oob() copies the data of one page to another, as
+ * for dhara_nand_copy(), but replaces the spare data.
+ */
+int dhara_nand_prog_oob(const struct dhara_nand *n, dhara_page_t p,
+			const uint8_t *data,
+			const uint8_t *oob, size_t length,
+			dhara_error_t *err);
+int dhara_nand_read_oob(const struct dhara_nand *n, dhara_page_t p,
+			size_t offset, size_t length,
+			uint8_t *oob,
+			dhara_error_t *err);
+int dhara_nand_copy_oob(const struct dhara_nand *n,
+			dhara_page_t src, dhara_page_t dst,
+			const uint8_t *oob, size_t length,
+			dhara_error_t *err);
+
 #endif
@@ -0,0 +1,63 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include "part.h"
+
+int dhara_part_init(struct dhara_nand *part, const struct dhara_nand *chip,
+		    dhara_block_t first, unsigned int num_blocks,
+		    dhara_error_t *err)
+{
+	const dhara_block_t plane_mask = (1 << chip->log2_planes) - 1;
+
+	if (!num_blocks || (first >= chip->num_blocks) ||
+	    (num_blocks > chip->num_blocks - first) ||
+	    ((first | num_blocks) & plane_mask)) {
+		dhara_set_error(err, DHARA_E_PARTITION);
+		return -1;
+	}
+
+	part->log2_page_size = chip->log2_page_size;
+	part->log2_ppb = chip->log2_ppb;
+	part->num_blocks = num_blocks;
+	part->log2_planes = chip->log2_planes;
+	part->first_block = chip->first_block + first;
+
+	return 0;
+}
+
+int dhara_part_split(struct dhara_nand *parts, const struct dhara_nand *chip,
+		     const unsigned int *sizes, unsigned int count,
+		     dhara_error_t *err)
+{
+	dhara_block_t first = 0;
+	unsigned int i;
+
+	for (i = 0; i < count; i++) {
+		unsigned int size = sizes[i];
+
+		if (!size && (i + 1 == count) && (first < chip->num_blocks))
+			size = (chip->num_blocks - first) &
+				~((1 << chip->log2_planes) - 1);
+
+		if (dhara_part_init(&parts[i], chip, first, size, err) < 0)
+			return -1;
+
+		first += size;
+	}
+
+	return 0;
+}
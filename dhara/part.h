@@ -0,0 +1,61 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#ifndef DHARA_PART_H_
+#define DHARA_PART_H_
+
+#include "nand.h"
+
+/* A chip may be divided into partitions, each of which is a contiguous
+ * range of physical blocks presented as a separate NAND device. Each
+ * partition can be managed by its own map, with its own journal and
+ * garbage collection, so maps on different partitions don't contend
+ * with one another (other than for access to the chip itself).
+ *
+ * A partition is described by an ordinary struct dhara_nand, with the
+ * page and plane geometry of the chip and a first_block offset. The
+ * NAND functions are always called with physical block and page
+ * numbers, so no changes are needed in the driver.
+ *
+ * If the chip has more than one die, placing partitions on separate
+ * dies allows them to be accessed in parallel.
+ */
+
+/* Describe a range of blocks of the given chip (which may itself be a
+ * partition). The range must lie within the chip, and if the chip
+ * uses multi-plane erase, it must be aligned to a plane group.
+ *
+ * Returns 0 on success, or -1 with E_PARTITION if the range is
+ * invalid.
+ */
+int dhara_part_init(struct dhara_nand *part, const struct dhara_nand *chip,
+		    dhara_block_t first, unsigned int num_blocks,
+		    dhara_error_t *err);
+
+/* Divide a chip into consecutive partitions, given a table of sizes in
+ * blocks. The last size may be 0, in which case the last partition
+ * takes all remaining blocks. Blocks left over at the end of the chip
+ * are unused.
+ *
+ * Returns 0 on success, or -1 with E_PARTITION if the table doesn't
+ * fit.
+ */
+int dhara_part_split(struct dhara_nand *parts, const struct dhara_nand *chip,
+		     const unsigned int *sizes, unsigned int count,
+		     dhara_error_t *err);
+
+#endif
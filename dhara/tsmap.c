@@ -0,0 +1,333 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "tsmap.h"
+
+/* Shared holders run concurrently, so the shared wait counter needs
+ * an atomic increment. Without compiler support, the count may be
+ * inexact.
+ */
+#ifdef __GNUC__
+#define COUNT_WAIT(x)	__atomic_fetch_add(&(x), 1, __ATOMIC_RELAXED)
+#else
+#define COUNT_WAIT(x)	((x)++)
+#endif
+
+static void lock_shared(struct dhara_tsmap *t)
+{
+	const struct dhara_tsmap_lock *l = t->lock;
+
+	if (l->try_lock_shared && !l->try_lock_shared(l->arg))
+		return;
+
+	l->lock_shared(l->arg);
+
+	if (l->try_lock_shared)
+		COUNT_WAIT(t->shared_waits);
+}
+
+static void unlock_shared(struct dhara_tsmap *t)
+{
+	t->lock->unlock_shared(t->lock->arg);
+}
+
+static void lock_exclusive(struct dhara_tsmap *t)
+{
+	const struct dhara_tsmap_lock *l = t->lock;
+
+	if (l->try_lock_exclusive && !l->try_lock_exclusive(l->arg))
+		return;
+
+	l->lock_exclusive(l->arg);
+
+	if (l->try_lock_exclusive)
+		t->exclusive_waits++;
+}
+
+static void unlock_exclusive(struct dhara_tsmap *t)
+{
+	t->lock->unlock_exclusive(t->lock->arg);
+}
+
+int dhara_tsmap_init(struct dhara_tsmap *t, const struct dhara_nand *n,
+		     uint8_t *page_buf, uint8_t gc_ratio,
+		     const struct dhara_tsmap_lock *lock)
+{
+	t->lock = lock;
+	t->shared_waits = 0;
+	t->exclusive_waits = 0;
+
+	return dhara_map_init(&t->map, n, page_buf, gc_ratio);
+}
+
+int dhara_tsmap_resume(struct dhara_tsmap *t, dhara_error_t *err)
+{
+	int ret;
+
+	lock_exclusive(t);
+	ret = dhara_map_resume(&t->map, err);
+	unlock_exclusive(t);
+
+	return ret;
+}
+
+void dhara_tsmap_clear(struct dhara_tsmap *t)
+{
+	lock_exclusive(t);
+	dhara_map_clear(&t->map);
+	unlock_exclusive(t);
+}
+
+dhara_sector_t dhara_tsmap_capacity(struct dhara_tsmap *t)
+{
+	dhara_sector_t ret;
+
+	lock_shared(t);
+	ret = dhara_map_capacity(&t->map);
+	unlock_shared(t);
+
+	return ret;
+}
+
+dhara_sector_t dhara_tsmap_size(struct dhara_tsmap *t)
+{
+	dhara_sector_t ret;
+
+	lock_shared(t);
+	ret = dhara_map_size(&t->map);
+	unlock_shared(t);
+
+	return ret;
+}
+
+int dhara_tsmap_find(struct dhara_tsmap *t, dhara_sector_t s,
+		     dhara_page_t *loc, dhara_error_t *err)
+{
+	int ret;
+
+	lock_shared(t);
+	ret = dhara_map_find_nowait(&t->map, s, loc, err);
+	unlock_shared(t);
+
+	return ret;
+}
+
+int dhara_tsmap_read(struct dhara_tsmap *t, dhara_sector_t s,
+		     uint8_t *data, dhara_error_t *err)
+{
+	int ret;
+
+	lock_shared(t);
+	ret = dhara_map_read_nowait(&t->map, s, data, err);
+	unlock_shared(t);
+
+	return ret;
+}
+
+int dhara_tsmap_write(struct dhara_tsmap *t, dhara_sector_t s,
+		      const uint8_t *data, dhara_error_t *err)
+{
+	int ret;
+
+	lock_exclusive(t);
+	ret = dhara_map_write(&t->map, s, data, err);
+	unlock_exclusive(t);
+
+	return ret;
+}
+
+int dhara_tsmap_complete(struct dhara_tsmap *t, dhara_error_t *err)
+{
+	int ret;
+
+	lock_exclusive(t);
+	ret = dhara_map_complete(&t->map, err);
+	unlock_exclusive(t);
+
+	return ret;
+}
+
+int dhara_tsmap_copy_page(struct dhara_tsmap *t, dhara_page_t src,
+			  dhara_sector_t dst, dhara_error_t *err)
+{
+	int ret;
+
+	lock_exclusive(t);
+	ret = dhara_map_copy_page(&t->map, src, dst, err);
+	unlock_exclusive(t);
+
+	return ret;
+}
+
+int dhara_tsmap_copy_sector(struct dhara_tsmap *t, dhara_sector_t src,
+			    dhara_sector_t dst, dhara_error_t *err)
+{
+	int ret;
+
+	lock_exclusive(t);
+	ret = dhara_map_copy_sector(&t->map, src, dst, err);
+	unlock_exclusive(t);
+
+	return ret;
+}
+
+int dhara_tsmap_trim(struct dhara_tsmap *t, dhara_sector_t s,
+		     dhara_error_t *err)
+{
+	int ret;
+
+	lock_exclusive(t);
+	ret = dhara_map_trim(&t->map, s, err);
+	unlock_exclusive(t);
+
+	return ret;
+}
+
+int dhara_tsmap_sync(struct dhara_tsmap *t, dhara_error_t *err)
+{
+	int ret;
+
+	lock_exclusive(t);
+	ret = dhara_map_sync(&t->map, err);
+	unlock_exclusive(t);
+
+	return ret;
+}
+
+int dhara_tsmap_gc(struct dhara_tsmap *t, dhara_error_t *err)
+{
+	int ret;
+
+	lock_exclusive(t);
+	ret = dhara_map_gc(&t->map, err);
+	unlock_exclusive(t);
+
+	return ret;
+}
+
+int dhara_tsmap_snapshot_create(struct dhara_tsmap *t,
+				struct dhara_map_snapshot *s,
+				dhara_error_t *err)
+{
+	int ret;
+
+	lock_exclusive(t);
+	ret = dhara_map_snapshot_create(&t->map, s, err);
+	unlock_exclusive(t);
+
+	return ret;
+}
+
+void dhara_tsmap_snapshot_release(struct dhara_tsmap *t,
+				  struct dhara_map_snapshot *s)
+{
+	lock_exclusive(t);
+	dhara_map_snapshot_release(&t->map, s);
+	unlock_exclusive(t);
+}
+
+int dhara_tsmap_snapshot_find(struct dhara_tsmap *t,
+			      const struct dhara_map_snapshot *s,
+			      dhara_sector_t target, dhara_page_t *loc,
+			      dhara_error_t *err)
+{
+	int ret;
+
+	lock_shared(t);
+	ret = dhara_map_snapshot_find(&t->map, s, target, loc, err);
+	unlock_shared(t);
+
+	return ret;
+}
+
+int dhara_tsmap_snapshot_read(struct dhara_tsmap *t,
+			      const struct dhara_map_snapshot *s,
+			      dhara_sector_t target, uint8_t *data,
+			      dhara_error_t *err)
+{
+	int ret;
+
+	lock_shared(t);
+	ret = dhara_map_snapshot_read(&t->map, s, target, data, err);
+	unlock_shared(t);
+
+	return ret;
+}
+
+void dhara_tsmap_reader_begin(struct dhara_tsmap *t,
+			      struct dhara_map_reader *r)
+{
+	lock_exclusive(t);
+	dhara_map_reader_begin(&t->map, r);
+	unlock_exclusive(t);
+}
+
+void dhara_tsmap_reader_end(struct dhara_tsmap *t,
+			    struct dhara_map_reader *r)
+{
+	lock_exclusive(t);
+	dhara_map_reader_end(&t->map, r);
+	unlock_exclusive(t);
+}
+
+int dhara_tsmap_reader_find(struct dhara_tsmap *t,
+			    const struct dhara_map_reader *r,
+			    dhara_sector_t target, dhara_page_t *loc,
+			    dhara_error_t *err)
+{
+	return dhara_map_reader_find(&t->map, r, target, loc, err);
+}
+
+int dhara_tsmap_reader_read(struct dhara_tsmap *t,
+			    const struct dhara_map_reader *r,
+			    dhara_sector_t target, uint8_t *data,
+			    dhara_error_t *err)
+{
+	return dhara_map_reader_read(&t->map, r, target, data, err);
+}
+
+void dhara_tsmap_write_start(struct dhara_tsmap *t,
+			     struct dhara_map_write_op *op,
+			     dhara_sector_t dst, const uint8_t *data)
+{
+	dhara_map_write_start(&t->map, op, dst, data);
+}
+
+int dhara_tsmap_write_step(struct dhara_tsmap *t,
+			   struct dhara_map_write_op *op,
+			   dhara_error_t *err)
+{
+	int ret;
+
+	lock_exclusive(t);
+	ret = dhara_map_write_step(&t->map, op, err);
+	unlock_exclusive(t);
+
+	return ret;
+}
+
+int dhara_tsmap_write_finish(struct dhara_tsmap *t,
+			     struct dhara_map_write_op *op,
+			     dhara_error_t *err)
+{
+	int ret;
+
+	do {
+		ret = dhara_tsmap_write_step(t, op, err);
+	} while (ret > 0);
+
+	return ret;
+}
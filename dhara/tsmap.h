@@ -0,0 +1,179 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef DHARA_TSMAP_H_
+#define DHARA_TSMAP_H_
+
+#include "map.h"
+
+/* Size of a cache line. You can define this in the build to suit your
+ * host.
+ */
+#ifndef DHARA_TSMAP_LINE_SIZE
+#define DHARA_TSMAP_LINE_SIZE		64
+#endif
+
+/* Lock primitives for the thread-safe map. A reader/writer lock is
+ * expected: shared holders may run concurrently with one another, but
+ * not with an exclusive holder. If you only have a mutex, supply the
+ * same functions for both modes.
+ *
+ * The try_ functions are optional. They should return 0 if the lock
+ * was acquired without waiting, or non-zero otherwise. If supplied,
+ * they're used to count contended acquisitions.
+ */
+struct dhara_tsmap_lock {
+	void		*arg;
+
+	void		(*lock_shared)(void *arg);
+	int		(*try_lock_shared)(void *arg);
+	void		(*unlock_shared)(void *arg);
+
+	void		(*lock_exclusive)(void *arg);
+	int		(*try_lock_exclusive)(void *arg);
+	void		(*unlock_exclusive)(void *arg);
+};
+
+/* Thread-safe front end to the map. Lookups (find and read) take the
+ * lock in shared mode, and everything else takes it exclusively.
+ *
+ * Note that concurrent lookups imply concurrent calls to
+ * dhara_nand_read(). Your NAND driver must permit this.
+ *
+ * When built with DHARA_NAND_ASYNC, a write releases the lock while its
+ * page is still being programmed. Lookups don't wait for the program
+ * (they use the _nowait functions in map.h), and the next operation
+ * which takes the lock exclusively completes it. The data buffer passed
+ * to dhara_tsmap_write() must remain valid until then.
+ */
+struct dhara_tsmap {
+	struct dhara_map		map;
+	const struct dhara_tsmap_lock	*lock;
+
+	/* Number of acquisitions which had to wait. These are diagnostic
+	 * counters only, and are maintained only if the optional try_
+	 * functions are supplied.
+	 *
+	 * Waiting readers update the shared counter concurrently, so it's
+	 * padded away from the fields which every lookup reads. Otherwise,
+	 * each update would evict them from the other readers' caches.
+	 */
+	uint8_t				pad[DHARA_TSMAP_LINE_SIZE];
+	unsigned long			shared_waits;
+	unsigned long			exclusive_waits;
+};
+
+/* Initialize a thread-safe map. Arguments are as for dhara_map_init(),
+ * with the addition of a set of lock primitives. The lock must be
+ * initialized before this call, and the structure describing it must
+ * outlive the map. Returns 0, or -1 as for dhara_map_init().
+ */
+int dhara_tsmap_init(struct dhara_tsmap *t, const struct dhara_nand *n,
+		     uint8_t *page_buf, uint8_t gc_ratio,
+		     const struct dhara_tsmap_lock *lock);
+
+/* Each of these takes the lock and calls the corresponding map
+ * function. See map.h for details.
+ */
+int dhara_tsmap_resume(struct dhara_tsmap *t, dhara_error_t *err);
+void dhara_tsmap_clear(struct dhara_tsmap *t);
+dhara_sector_t dhara_tsmap_capacity(struct dhara_tsmap *t);
+dhara_sector_t dhara_tsmap_size(struct dhara_tsmap *t);
+
+int dhara_tsmap_find(struct dhara_tsmap *t, dhara_sector_t s,
+		     dhara_page_t *loc, dhara_error_t *err);
+int dhara_tsmap_read(struct dhara_tsmap *t, dhara_sector_t s,
+		     uint8_t *data, dhara_error_t *err);
+
+int dhara_tsmap_write(struct dhara_tsmap *t, dhara_sector_t s,
+		      const uint8_t *data, dhara_error_t *err);
+int dhara_tsmap_complete(struct dhara_tsmap *t, dhara_error_t *err);
+int dhara_tsmap_copy_page(struct dhara_tsmap *t, dhara_page_t src,
+			  dhara_sector_t dst, dhara_error_t *err);
+int dhara_tsmap_copy_sector(struct dhara_tsmap *t, dhara_sector_t src,
+			    dhara_sector_t dst, dhara_error_t *err);
+int dhara_tsmap_trim(struct dhara_tsmap *t, dhara_sector_t s,
+		     dhara_error_t *err);
+int dhara_tsmap_sync(struct dhara_tsmap *t, dhara_error_t *err);
+int dhara_tsmap_gc(struct dhara_tsmap *t, dhara_error_t *err);
+
+/* Snapshots (see map.h). Creating and releasing a snapshot takes the
+ * lock exclusively, and snapshot lookups take it in shared mode.
+ */
+int dhara_tsmap_snapshot_create(struct dhara_tsmap *t,
+				struct dhara_map_snapshot *s,
+				dhara_error_t *err);
+void dhara_tsmap_snapshot_release(struct dhara_tsmap *t,
+				  struct dhara_map_snapshot *s);
+int dhara_tsmap_snapshot_find(struct dhara_tsmap *t,
+			      const struct dhara_map_snapshot *s,
+			      dhara_sector_t target, dhara_page_t *loc,
+			      dhara_error_t *err);
+int dhara_tsmap_snapshot_read(struct dhara_tsmap *t,
+			      const struct dhara_map_snapshot *s,
+			      dhara_sector_t target, uint8_t *data,
+			      dhara_error_t *err);
+
+/* Concurrent readers (see map.h). Registering and unregistering a
+ * reader takes the lock exclusively. Reader lookups don't take the
+ * lock at all.
+ */
+void dhara_tsmap_reader_begin(struct dhara_tsmap *t,
+			      struct dhara_map_reader *r);
+void dhara_tsmap_reader_end(struct dhara_tsmap *t,
+			    struct dhara_map_reader *r);
+int dhara_tsmap_reader_find(struct dhara_tsmap *t,
+			    const struct dhara_map_reader *r,
+			    dhara_sector_t target, dhara_page_t *loc,
+			    dhara_error_t *err);
+int dhara_tsmap_reader_read(struct dhara_tsmap *t,
+			    const struct dhara_map_reader *r,
+			    dhara_sector_t target, uint8_t *data,
+			    dhara_error_t *err);
+
+/* Step-wise writes (see map.h). Each step takes the lock exclusively,
+ * so lookups may run between steps. Only one write may be in progress,
+ * and no other operation which takes the lock exclusively may be made
+ * until it's done. If there are several writing threads, they must
+ * arrange this between themselves.
+ */
+void dhara_tsmap_write_start(struct dhara_tsmap *t,
+			     struct dhara_map_write_op *op,
+			     dhara_sector_t dst, const uint8_t *data);
+int dhara_tsmap_write_step(struct dhara_tsmap *t,
+			   struct dhara_map_write_op *op,
+			   dhara_error_t *err);
+int dhara_tsmap_write_finish(struct dhara_tsmap *t,
+			     struct dhara_map_write_op *op,
+			     dhara_error_t *err);
+
+/* Obtain the number of contended acquisitions since initialization.
+ * The counters are read without taking the lock, so the values are
+ * approximate if other threads are active.
+ */
+static inline unsigned long
+dhara_tsmap_shared_waits(const struct dhara_tsmap *t)
+{
+	return t->shared_waits;
+}
+
+static inline unsigned long
+dhara_tsmap_exclusive_waits(const struct dhara_tsmap *t)
+{
+	return t->exclusive_waits;
+}
+
+#endif
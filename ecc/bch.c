@@ -17,43 +17,85 @@
 #include <string.h>
 #include "bch.h"
 #include "gf13.h"
+#include "clmul.h"
 
-#define BCH_MAX_SYNS		8
-
-const struct bch_def bch_1bit = {
-	.syns		= 2,
-	.generator	= 0x201b,
-	.degree		= 13,
-	.ecc_bytes	= 2
-};
-
-const struct bch_def bch_2bit = {
-	.syns		= 4,
-	.generator	= 0x4d5154b,
-	.degree		= 26,
-	.ecc_bytes	= 4
-};
-
-const struct bch_def bch_3bit = {
-	.syns		= 6,
-	.generator	= 0xbaf5b2bded,
-	.degree		= 39,
-	.ecc_bytes	= 5
-};
-
-const struct bch_def bch_4bit = {
-	.syns		= 8,
-	.generator	= 0x14523043ab86ab,
-	.degree		= 52,
-	.ecc_bytes	= 7
-};
-
-static bch_poly_t chunk_remainder(const struct bch_def *def,
-				  const uint8_t *chunk, size_t len)
+#define BCH_MAX_SYNS		48
+
+/* Number of words needed to hold the generator */
+static inline int poly_words(const struct bch_def *def)
+{
+	return (def->degree >> 6) + 1;
+}
+
+static bch_poly_t narrow_remainder(const struct bch_def *def,
+				   const uint8_t *chunk, size_t len)
 {
 	bch_poly_t remainder = 0;
+	uint8_t acc[16];
 	int i;
 
+	/* Fold the bulk of the chunk with carry-less multiplies, if we
+	 * can, and then finish off the accumulator and the rest.
+	 */
+	if (def->fold[0]) {
+		const size_t n = clmul_fold(def->fold, chunk, len, 0, acc);
+
+		if (n) {
+			remainder = narrow_remainder(def, acc, sizeof(acc));
+			chunk += n;
+			len -= n;
+		}
+	}
+
+	/* Table-driven: four bytes at a time, and then one byte at a
+	 * time for what remains. With 32-bit entries, each group of four
+	 * bytes shifts the whole remainder out.
+	 */
+	if (def->table32) {
+		const uint32_t *t = def->table32;
+		uint32_t r = remainder;
+
+		for (i = 0; i + 4 <= len; i += 4) {
+			r ^= ~(chunk[i] |
+			       (chunk[i + 1] << 8) |
+			       (chunk[i + 2] << 16) |
+			       ((uint32_t)chunk[i + 3] << 24));
+
+			r = t[0x300 | (r & 0xff)] ^
+				t[0x200 | ((r >> 8) & 0xff)] ^
+				t[0x100 | ((r >> 16) & 0xff)] ^
+				t[r >> 24];
+		}
+
+		for (; i < len; i++)
+			r = (r >> 8) ^ t[(r ^ chunk[i] ^ 0xff) & 0xff];
+
+		return r;
+	}
+
+	if (def->table) {
+		const bch_poly_t *t = def->table;
+
+		for (i = 0; i + 4 <= len; i += 4) {
+			remainder ^= ~(chunk[i] |
+				       (chunk[i + 1] << 8) |
+				       (chunk[i + 2] << 16) |
+				       ((uint32_t)chunk[i + 3] << 24));
+
+			remainder = (remainder >> 32) ^
+				t[0x300 | (remainder & 0xff)] ^
+				t[0x200 | ((remainder >> 8) & 0xff)] ^
+				t[0x100 | ((remainder >> 16) & 0xff)] ^
+				t[(remainder >> 24) & 0xff];
+		}
+
+		for (; i < len; i++)
+			remainder = (remainder >> 8) ^
+				t[(remainder ^ chunk[i] ^ 0xff) & 0xff];
+
+		return remainder;
+	}
+
 	for (i = 0; i < len; i++) {
 		int j;
 
@@ -61,7 +103,7 @@ static bch_poly_t chunk_remainder(const struct bch_def *def,
 
 		for (j = 0; j < 8; j++) {
 			if (remainder & 1)
-				remainder ^= def->generator;
+				remainder ^= def->generator[0];
 			remainder >>= 1;
 		}
 	}
@@ -69,131 +111,256 @@ static bch_poly_t chunk_remainder(const struct bch_def *def,
 	return remainder;
 }
 
-static void pack_poly(const struct bch_def *def, bch_poly_t poly, uint8_t *ecc)
+/* Shift a wide polynomial right by the given number of bits (1-63) */
+static void wide_shift(bch_poly_t *r, int words, int n)
 {
 	int i;
 
-	for (i = 0; i < def->ecc_bytes; i++) {
-		ecc[i] = ~poly;
-		poly >>= 8;
+	for (i = 0; i < words - 1; i++)
+		r[i] = (r[i] >> n) | (r[i + 1] << (64 - n));
+
+	r[i] >>= n;
+}
+
+static void wide_remainder(const struct bch_def *def,
+			   const uint8_t *chunk, size_t len,
+			   bch_poly_t *remainder)
+{
+	const int words = poly_words(def);
+	int i;
+
+	memset(remainder, 0, words * sizeof(remainder[0]));
+
+	/* Table-driven: one byte at a time */
+	if (def->table) {
+		const int tw = (def->degree + 63) >> 6;
+
+		for (i = 0; i < len; i++) {
+			const bch_poly_t *t = def->table +
+				((remainder[0] ^ chunk[i] ^ 0xff) & 0xff) * tw;
+			int k;
+
+			wide_shift(remainder, words, 8);
+			for (k = 0; k < tw; k++)
+				remainder[k] ^= t[k];
+		}
+
+		return;
+	}
+
+	for (i = 0; i < len; i++) {
+		int j;
+
+		remainder[0] ^= chunk[i] ^ 0xff;
+
+		for (j = 0; j < 8; j++) {
+			if (remainder[0] & 1) {
+				int k;
+
+				for (k = 0; k < words; k++)
+					remainder[k] ^= def->generator[k];
+			}
+
+			wide_shift(remainder, words, 1);
+		}
 	}
 }
 
-static bch_poly_t unpack_poly(const struct bch_def *def, const uint8_t *ecc)
+static void chunk_remainder(const struct bch_def *def,
+			    const uint8_t *chunk, size_t len,
+			    bch_poly_t *remainder)
+{
+	if (poly_words(def) > 1)
+		wide_remainder(def, chunk, len, remainder);
+	else
+		remainder[0] = narrow_remainder(def, chunk, len);
+}
+
+static void pack_poly(const struct bch_def *def, const bch_poly_t *poly,
+		      uint8_t *ecc)
 {
-	bch_poly_t poly = 0;
 	int i;
 
-	for (i = def->ecc_bytes - 1; i >= 0; i--) {
-		poly <<= 8;
-		poly |= ecc[i] ^ 0xff;
+	for (i = 0; i < def->ecc_bytes; i++)
+		ecc[i] = ~(poly[i >> 3] >> ((i & 7) << 3));
+}
+
+static void unpack_poly(const struct bch_def *def, const uint8_t *ecc,
+			bch_poly_t *poly)
+{
+	const int words = poly_words(def);
+	int i;
+
+	memset(poly, 0, words * sizeof(poly[0]));
+
+	for (i = 0; i < def->ecc_bytes; i++)
+		poly[i >> 3] |= ((bch_poly_t)(ecc[i] ^ 0xff)) << ((i & 7) << 3);
+
+	poly[def->degree >> 6] &= (((bch_poly_t)1) << (def->degree & 63)) - 1;
+}
+
+/* Find the difference between the recomputed and stored remainders.
+ * Returns non-zero if they differ.
+ */
+static int remainder_diff(const struct bch_def *def,
+			  const uint8_t *chunk, size_t len,
+			  const uint8_t *ecc, bch_poly_t *diff)
+{
+	bch_poly_t stored[BCH_MAX_WORDS];
+	bch_poly_t any = 0;
+	int i;
+
+	chunk_remainder(def, chunk, len, diff);
+	unpack_poly(def, ecc, stored);
+
+	for (i = 0; i < poly_words(def); i++) {
+		diff[i] ^= stored[i];
+		any |= diff[i];
 	}
 
-	poly &= ((1LL << def->degree) - 1);
-	return poly;
+	return any != 0;
 }
 
 void bch_generate(const struct bch_def *bch,
 		  const uint8_t *chunk, size_t len, uint8_t *ecc)
 {
-	pack_poly(bch, chunk_remainder(bch, chunk, len), ecc);
+	bch_poly_t remainder[BCH_MAX_WORDS];
+
+	chunk_remainder(bch, chunk, len, remainder);
+	pack_poly(bch, remainder, ecc);
 }
 
 int bch_verify(const struct bch_def *bch,
 	       const uint8_t *chunk, size_t len, const uint8_t *ecc)
 {
-	return (chunk_remainder(bch, chunk, len) == unpack_poly(bch, ecc)) ?
-		0 : -1;
+	bch_poly_t diff[BCH_MAX_WORDS];
+
+	return remainder_diff(bch, chunk, len, ecc, diff) ? -1 : 0;
+}
+
+/************************************************************************
+ * Galois field arithmetic. Codes are defined over GF(2^13), unless they
+ * supply another field. Elements of all fields are 16-bit.
+ */
+
+typedef uint16_t gf_elem_t;
+
+static inline gf_elem_t gf_mul(const struct bch_def *def,
+			       gf_elem_t a, gf_elem_t b)
+{
+	return def->field ? def->field->mul(a, b) : gf13_mul(a, b);
+}
+
+static inline gf_elem_t gf_div(const struct bch_def *def,
+			       gf_elem_t a, gf_elem_t b)
+{
+	return def->field ? def->field->div(a, b) : gf13_div(a, b);
+}
+
+static inline gf_elem_t gf_mulx(const struct bch_def *def, gf_elem_t a)
+{
+	return def->field ? def->field->mulx(a) : gf13_mulx(a);
+}
+
+static inline gf_elem_t gf_divx(const struct bch_def *def, gf_elem_t a)
+{
+	return def->field ? def->field->divx(a) : gf13_divx(a);
+}
+
+/* Discrete log of a non-zero element, or -1 if there are no tables */
+static int gf_log(const struct bch_def *def, gf_elem_t a)
+{
+	if (def->field)
+		return def->field->log ? def->field->log(a) : -1;
+
+#if defined(GF13_NO_TABLES) || defined(GF13_SMALL_TABLES)
+	return -1;
+#else
+	return gf13_wrap(gf13_log[a]);
+#endif
 }
 
 /************************************************************************
- * Polynomials over GF(2^13)
+ * Polynomials over the code's field
  */
 
 #define MAX_POLY	(BCH_MAX_SYNS * 2)
 
-static void poly_add(gf13_elem_t *dst, const gf13_elem_t *src,
-		     gf13_elem_t c, int shift)
+static void poly_add(const struct bch_def *def,
+		     gf_elem_t *dst, const gf_elem_t *src,
+		     gf_elem_t c, int shift)
 {
 	int i;
 
 	for (i = 0; i < MAX_POLY; i++) {
 		int p = i + shift;
-		gf13_elem_t v = src[i];
+		gf_elem_t v = src[i];
 
 		if (p < 0 || p >= MAX_POLY)
 			continue;
 		if (!v)
 			continue;
 
-		dst[p] ^= gf13_mul(v, c);
+		dst[p] ^= gf_mul(def, v, c);
 	}
 }
 
-static gf13_elem_t poly_eval(const gf13_elem_t *s, gf13_elem_t x)
-{
-	int i;
-	gf13_elem_t sum = 0;
-	gf13_elem_t t = x;
+/************************************************************************
+ * Error correction
+ */
 
-	for (i = 0; i < MAX_POLY; i++) {
-		const gf13_elem_t c = s[i];
+/* Raise a non-zero element to the given power */
+static gf_elem_t power(const struct bch_def *def, gf_elem_t x,
+		       unsigned int n)
+{
+	gf_elem_t r = 1;
 
-		if (c)
-			sum ^= gf13_mul(c, t);
+	while (n) {
+		if (n & 1)
+			r = gf_mul(def, r, x);
 
-		t = gf13_mul(t, x);
+		x = gf_mul(def, x, x);
+		n >>= 1;
 	}
 
-	return sum;
+	return r;
 }
 
-/************************************************************************
- * Error correction
+/* Compute a syndrome of the received word. The chunk with its
+ * recomputed remainder is a codeword, so the received word differs from
+ * a codeword only in the ECC bits, by diff (the recomputed remainder
+ * XOR the stored one). The syndrome is therefore that of diff, shifted
+ * past the chunk bits, and doesn't require another pass over the chunk.
  */
-
-static gf13_elem_t syndrome(const struct bch_def *bch,
-			    const uint8_t *chunk,
-			    size_t len,
-			    bch_poly_t remainder,
-			    gf13_elem_t x)
+static gf_elem_t syndrome(const struct bch_def *bch, size_t len,
+			  const bch_poly_t *diff, gf_elem_t x)
 {
-	gf13_elem_t y = 0;
-	gf13_elem_t t = 1;
+	gf_elem_t y = 0;
 	int i;
 
-	for (i = 0; i < len; i++) {
-		uint8_t c = chunk[i] ^ 0xff;
-		int j;
-
-		for (j = 0; j < 8; j++) {
-			if (c & 1)
-				y ^= t;
+	for (i = bch->degree - 1; i >= 0; i--) {
+		if (y)
+			y = gf_mul(bch, y, x);
 
-			c >>= 1;
-			t = gf13_mul(t, x);
-		}
+		if ((diff[i >> 6] >> (i & 63)) & 1)
+			y ^= 1;
 	}
 
-	for (i = 0; i < bch->degree; i++) {
-		if (remainder & 1)
-			y ^= t;
-
-		remainder >>= 1;
-		t = gf13_mul(t, x);
-	}
+	if (!y)
+		return 0;
 
-	return y;
+	return gf_mul(bch, y, power(bch, x, len << 3));
 }
 
-static void berlekamp_massey(const gf13_elem_t *s, int N,
-			     gf13_elem_t *sigma)
+/* Find the error locator polynomial, and return its degree */
+static int berlekamp_massey(const struct bch_def *def,
+			    const gf_elem_t *s, int N, gf_elem_t *sigma)
 {
-	gf13_elem_t C[MAX_POLY];
-	gf13_elem_t B[MAX_POLY];
+	gf_elem_t C[MAX_POLY];
+	gf_elem_t B[MAX_POLY];
 	int L = 0;
 	int m = 1;
-	gf13_elem_t b = 1;
+	gf_elem_t b = 1;
 	int n;
 
 	memset(sigma, 0, MAX_POLY * sizeof(sigma[0]));
@@ -203,73 +370,156 @@ static void berlekamp_massey(const gf13_elem_t *s, int N,
 	C[0] = 1;
 
 	for (n = 0; n < N; n++) {
-		gf13_elem_t d = s[n];
-		gf13_elem_t mult;
+		gf_elem_t d = s[n];
+		gf_elem_t mult;
 		int i;
 
 		for (i = 1; i <= L; i++) {
 			if (!(C[i] && s[n - i]))
 				continue;
 
-			d ^= gf13_mul(C[i], s[n - i]);
+			d ^= gf_mul(def, C[i], s[n - i]);
 		}
 
-		mult = gf13_div(d, b);
+		mult = gf_div(def, d, b);
 
 		if (!d) {
 			m++;
 		} else if (L * 2 <= n) {
-			gf13_elem_t T[MAX_POLY];
+			gf_elem_t T[MAX_POLY];
 
 			memcpy(T, C, sizeof(T));
-			poly_add(C, B, mult, m);
+			poly_add(def, C, B, mult, m);
 			memcpy(B, T, sizeof(B));
 			L = n + 1 - L;
 			b = d;
 			m = 1;
 		} else {
-			poly_add(C, B, mult, m);
+			poly_add(def, C, B, mult, m);
 			m++;
 		}
 	}
 
-	memcpy(sigma, C, MAX_POLY);
+	memcpy(sigma, C, sizeof(C));
+	return L;
 }
 
-void bch_repair(const struct bch_def *bch,
-		uint8_t *chunk, size_t len, uint8_t *ecc)
+/* Chien search: term k of sigma is kept multiplied by x^-ik, so that
+ * each step needs only one multiply per term, by the constant x^-k.
+ * Stops once all roots have been found, and returns the number found.
+ */
+static int chien_search(const struct bch_def *def, gf_elem_t *sigma,
+			int nerr, int total_bits, int *where)
 {
-	const bch_poly_t remainder = unpack_poly(bch, ecc);
-	const int chunk_bits = len << 3;
-	gf13_elem_t syns[BCH_MAX_SYNS];
-	gf13_elem_t sigma[MAX_POLY];
-	gf13_elem_t x;
+	gf_elem_t step[BCH_MAX_SYNS / 2 + 1];
+	int found = 0;
 	int i;
 
-	/* Compute syndrome vector */
+	step[0] = 1;
+	for (i = 1; i <= nerr; i++)
+		step[i] = gf_divx(def, step[i - 1]);
+
+	for (i = 0; (i < total_bits) && (found < nerr); i++) {
+		gf_elem_t sum = 0;
+		int k;
+
+		for (k = 0; k <= nerr; k++)
+			sum ^= sigma[k];
+
+		if (!sum)
+			where[found++] = i;
+
+		for (k = 1; k <= nerr; k++)
+			if (sigma[k])
+				sigma[k] = gf_mul(def, sigma[k], step[k]);
+	}
+
+	return found;
+}
+
+/* A single error can be located directly: sigma is 1 + sigma[1]x,
+ * whose root x^-i gives sigma[1] = x^i. Returns -1 if the field has no
+ * log tables, in which case a Chien search is needed.
+ */
+static int locate_one(const struct bch_def *def, const gf_elem_t *sigma,
+		      int total_bits, int *where)
+{
+	int i;
+
+	if (!sigma[1])
+		return 0;
+
+	i = gf_log(def, sigma[1]);
+	if (i < 0)
+		return -1;
+
+	if (i >= total_bits)
+		return 0;
+
+	*where = i;
+	return 1;
+}
+
+int bch_repair(const struct bch_def *bch,
+	       uint8_t *chunk, size_t len, uint8_t *ecc)
+{
+	const int total_bits = (len << 3) + bch->degree;
+	bch_poly_t diff[BCH_MAX_WORDS];
+	gf_elem_t syns[BCH_MAX_SYNS];
+	gf_elem_t sigma[MAX_POLY];
+	int where[BCH_MAX_SYNS / 2];
+	int nerr;
+	int found;
+	gf_elem_t x;
+	int i;
+
+	/* Nothing to correct? */
+	if (!remainder_diff(bch, chunk, len, ecc, diff))
+		return 0;
+
+	/* Compute syndrome vector. For a binary code, the syndrome at
+	 * x^2i is the square of the one at x^i.
+	 */
 	x = 2;
 	for (i = 0; i < bch->syns; i++) {
-		syns[i] = syndrome(bch, chunk, len, remainder, x);
-		x = gf13_mulx(x);
+		if (!(i & 1))
+			syns[i] = syndrome(bch, len, diff, x);
+		else if (syns[i >> 1])
+			syns[i] = gf_mul(bch, syns[i >> 1], syns[i >> 1]);
+		else
+			syns[i] = 0;
+
+		x = gf_mulx(bch, x);
 	}
 
-	/* Compute sigma */
-	berlekamp_massey(syns, bch->syns, sigma);
+	/* Compute sigma. We can locate at most one error per pair of
+	 * syndromes.
+	 */
+	nerr = berlekamp_massey(bch, syns, bch->syns, sigma);
+	if (!nerr || (nerr > (bch->syns >> 1)))
+		return -1;
+
+	/* Each root of sigma, x^-i, corresponds to an error in bit i */
+	found = (nerr == 1) ? locate_one(bch, sigma, total_bits, where) : -1;
+	if (found < 0)
+		found = chien_search(bch, sigma, nerr, total_bits, where);
 
-	/* Each root of sigma corresponds to an error location. Correct
-	 * errors in the chunk data first.
+	/* If some roots lie outside the word, there were more errors
+	 * than we can correct. Leave the data untouched.
 	 */
-	x = 1;
-	for (i = 0; i < chunk_bits; i++) {
-		if (!poly_eval(sigma, x))
-			chunk[i >> 3] ^= 1 << (i & 7);
-		x = gf13_divx(x);
+	if (found < nerr)
+		return -1;
+
+	/* Correct errors in the chunk data, or in the ECC data */
+	for (i = 0; i < found; i++) {
+		const int b = where[i];
+		const int e = b - (len << 3);
+
+		if (e < 0)
+			chunk[b >> 3] ^= 1 << (b & 7);
+		else
+			ecc[e >> 3] ^= 1 << (e & 7);
 	}
 
-	/* Then correct errors in the ECC data */
-	for (i = 0; i < bch->degree; i++) {
-		if (!poly_eval(sigma, x))
-			ecc[i >> 3] ^= 1 << (i & 7);
-		x = gf13_divx(x);
-	}
+	return found;
 }
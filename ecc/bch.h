@@ -31,6 +31,42 @@
  */
 typedef uint64_t bch_poly_t;
 
+/* Generators of degree 64 and above are held in several words, least
+ * significant first. This is enough for degree 336 (24-bit ECC over
+ * GF(2^14)).
+ */
+#define BCH_MAX_WORDS		6
+
+/* Remainder tables are omitted from the codes supplied here if
+ * BCH_NO_TABLES is defined.
+ */
+#ifdef BCH_NO_TABLES
+#define BCH_TABLE(t)		NULL
+#else
+#define BCH_TABLE(t)		(t)
+#endif
+
+/* Remainder tables for codes of degree under 64 hold four slices of 256
+ * entries each. For codes of degree 32 or less, the entries may be
+ * 32-bit (see struct bch_def). Wider codes have a byte-wise table of
+ * 256 entries, each of (degree + 63) / 64 words.
+ */
+#define BCH_TABLE_SIZE		1024
+
+/* Arithmetic for codes over a field other than GF(2^13). Elements are
+ * held in 16 bits. The log function is optional, and gives the discrete
+ * log (0 to order - 1) of a non-zero element.
+ */
+struct bch_field {
+	int		order;
+
+	uint16_t	(*mul)(uint16_t a, uint16_t b);
+	uint16_t	(*div)(uint16_t a, uint16_t b);
+	uint16_t	(*mulx)(uint16_t a);
+	uint16_t	(*divx)(uint16_t a);
+	int		(*log)(uint16_t a);
+};
+
 struct bch_def {
 	/* Number of syndromes to compute when decoding */
 	int		syns;
@@ -38,32 +74,74 @@ struct bch_def {
 	/* Generator polynominal, in reciprocal form: LSB is
 	 * highest-order term.
 	 */
-	bch_poly_t	generator;
+	bch_poly_t	generator[BCH_MAX_WORDS];
 
 	/* Generator degree */
 	int		degree;
 
 	/* Number of ECC bytes */
 	int		ecc_bytes;
+
+	/* Galois field. If NULL, the code is over GF(2^13), using the
+	 * arithmetic in gf13.h. Fields are supplied this way so that
+	 * users of the GF(2^13) codes don't link other fields' tables.
+	 */
+	const struct bch_field *field;
+
+	/* Optional remainder table (see BCH_TABLE_SIZE and tools/gentab).
+	 * Codes of degree 32 or less may give a table of 32-bit entries
+	 * in table32 instead, which is half the size. If neither is
+	 * given, the remainder is computed bit by bit.
+	 */
+	const bch_poly_t *table;
+	const uint32_t *table32;
+
+	/* Optional carry-less multiply folding constants, for codes of
+	 * degree under 64 (see ecc/clmul.h and tools/gentab). Leave zero
+	 * if not available.
+	 */
+	bch_poly_t	fold[4];
 };
 
-/* Maximum number of ECC bytes (required for 4-bit codes). Some codes
+/* Maximum number of ECC bytes (required for 24-bit codes). Some codes
  * require less than this.
  */
-#define BCH_MAX_ECC		7
+#define BCH_MAX_ECC		42
 
-/* This is fixed. We must have that the number of bits in a chunk, plus
- * the number of bits of ECC, is less than the Galois field order. You
- * can supply chunks smaller than this.
+/* We must have that the number of bits in a chunk, plus the number of
+ * bits of ECC, is less than the Galois field order. You can supply
+ * chunks smaller than this. BCH_MAX_CHUNK_SIZE is the limit for the 1
+ * to 4-bit codes.
  */
-#define BCH_MAX_CHUNK_SIZE	(1023 - BCH_MAX_ECC)
+#define BCH_MAX_CHUNK_SIZE	(1023 - 7)
 
-/* BCH codes for 1, 2, 3 and 4-bit ECC */
+static inline size_t bch_max_chunk_size(const struct bch_def *bch)
+{
+	const int order = bch->field ? bch->field->order : 8191;
+
+	return (order - 1 - bch->degree) >> 3;
+}
+
+/* BCH codes for 1, 2, 3 and 4-bit ECC. Each code is defined, with its
+ * remainder table, in its own file (bch_1bit.c and so on), so build
+ * only those you use. If you need to reduce the code size further, you
+ * can define BCH_NO_TABLES, and the codes will be built without
+ * remainder tables.
+ */
 extern const struct bch_def bch_1bit;
 extern const struct bch_def bch_2bit;
 extern const struct bch_def bch_3bit;
 extern const struct bch_def bch_4bit;
 
+/* Stronger codes: 8 and 16-bit ECC over GF(2^13), for chunks of up to
+ * 1010 and 997 bytes respectively (typically 512), and 24-bit ECC over
+ * GF(2^14), for chunks of up to 2005 bytes (typically 1024). The 24-bit
+ * code is defined in bch_24bit.c, and needs gf14.c.
+ */
+extern const struct bch_def bch_8bit;
+extern const struct bch_def bch_16bit;
+extern const struct bch_def bch_24bit;
+
 /* Generate ECC bytes for the given page. */
 void bch_generate(const struct bch_def *bch,
 		  const uint8_t *chunk, size_t len,
@@ -80,10 +158,14 @@ int bch_verify(const struct bch_def *bch,
 	       const uint8_t *chunk, size_t len,
 	       const uint8_t *ecc);
 
-/* Correct errors. After correction, bch_verify() should be run again to
- * check for uncorrectable errors.
+/* Correct errors. Returns the number of bits corrected (0 if there
+ * were no errors), or -1 if the errors can't be located (there are too
+ * many), in which case nothing is changed. Corrected bits may be in
+ * either the chunk or the ECC.
+ * Too many errors may still be miscorrected, so after correction,
+ * bch_verify() should be run again to check for uncorrectable errors.
  */
-void bch_repair(const struct bch_def *bch,
-		uint8_t *chunk, size_t len, uint8_t *ecc);
+int bch_repair(const struct bch_def *bch,
+	       uint8_t *chunk, size_t len, uint8_t *ecc);
 
 #endif
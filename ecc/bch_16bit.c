@@ -0,0 +1,551 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include "bch.h"
+
+/* 16-bit ECC over GF(2^13). Each code has its own file, so that only
+ * the tables for codes in use are linked.
+ */
+
+#ifndef BCH_NO_TABLES
+/* Byte-wise remainder table, generated with tools/gentab from the
+ * generator polynomial (shifted right by one bit).
+ */
+static const bch_poly_t bch_16bit_table[256 * 4] = {
+	0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000,
+	0xa1e68846888c9ebc, 0x6f4d7eb2bd9a4e88,
+	0xcd8a66817a6f6911, 0x0000000000008a40,
+	0xf0b5b68cdcc9c0a9, 0x219d0acf3ecb9f7e,
+	0xa41973c7976b2902, 0x000000000000df3f,
+	0x51533eca54455e15, 0x4ed0747d8351d1f6,
+	0x69931546ed044013, 0x000000000000557f,
+	0x5213cb1874437c83, 0xbc3de23438683c92,
+	0x773f594a4d63a924, 0x00000000000075c1,
+	0xf3f5435efccfe23f, 0xd3709c8685f2721a,
+	0xbab53fcb370cc035, 0x000000000000ff81,
+	0xa2a67d94a88abc2a, 0x9da0e8fb06a3a3ec,
+	0xd3262a8dda088026, 0x000000000000aafe,
+	0x0340f5d220062296, 0xf2ed9649bb39ed64,
+	0x1eac4c0ca067e937, 0x00000000000020be,
+	0xa4279630e886f906, 0x787bc46870d07924,
+	0xee7eb2949ac75249, 0x000000000000eb82,
+	0x05c11e76600a67ba, 0x1736badacd4a37ac,
+	0x23f4d415e0a83b58, 0x00000000000061c2,
+	0x549220bc344f39af, 0x59e6cea74e1be65a,
+	0x4a67c1530dac7b4b, 0x00000000000034bd,
+	0xf574a8fabcc3a713, 0x36abb015f381a8d2,
+	0x87eda7d277c3125a, 0x000000000000befd,
+	0xf6345d289cc58585, 0xc446265c48b845b6,
+	0x9941ebded7a4fb6d, 0x0000000000009e43,
+	0x57d2d56e14491b39, 0xab0b58eef5220b3e,
+	0x54cb8d5fadcb927c, 0x0000000000001403,
+	0x0681eba4400c452c, 0xe5db2c937673dac8,
+	0x3d58981940cfd26f, 0x000000000000417c,
+	0xa76763e2c880db90, 0x8a965221cbe99440,
+	0xf0d2fe983aa0bb7e, 0x000000000000cb3c,
+	0xfb378a601cdd0fdd, 0x0ff07f7aa45ff026,
+	0xe3f0dbec563b5fb2, 0x0000000000001cbb,
+	0x5ad1022694519161, 0x60bd01c819c5beae,
+	0x2e7abd6d2c5436a3, 0x00000000000096fb,
+	0x0b823cecc014cf74, 0x2e6d75b59a946f58,
+	0x47e9a82bc15076b0, 0x000000000000c384,
+	0xaa64b4aa489851c8, 0x41200b07270e21d0,
+	0x8a63ceaabb3f1fa1, 0x00000000000049c4,
+	0xa9244178689e735e, 0xb3cd9d4e9c37ccb4,
+	0x94cf82a61b58f696, 0x000000000000697a,
+	0x08c2c93ee012ede2, 0xdc80e3fc21ad823c,
+	0x5945e42761379f87, 0x000000000000e33a,
+	0x5991f7f4b457b3f7, 0x92509781a2fc53ca,
+	0x30d6f1618c33df94, 0x000000000000b645,
+	0xf8777fb23cdb2d4b, 0xfd1de9331f661d42,
+	0xfd5c97e0f65cb685, 0x0000000000003c05,
+	0x5f101c50f45bf6db, 0x778bbb12d48f8902,
+	0x0d8e6978ccfc0dfb, 0x000000000000f739,
+	0xfef694167cd76867, 0x18c6c5a06915c78a,
+	0xc0040ff9b69364ea, 0x0000000000007d79,
+	0xafa5aadc28923672, 0x5616b1ddea44167c,
+	0xa9971abf5b9724f9, 0x0000000000002806,
+	0x0e43229aa01ea8ce, 0x395bcf6f57de58f4,
+	0x641d7c3e21f84de8, 0x000000000000a246,
+	0x0d03d74880188a58, 0xcbb65926ece7b590,
+	0x7ab13032819fa4df, 0x00000000000082f8,
+	0xace55f0e089414e4, 0xa4fb2794517dfb18,
+	0xb73b56b3fbf0cdce, 0x00000000000008b8,
+	0xfdb661c45cd14af1, 0xea2b53e9d22c2aee,
+	0xdea843f516f48ddd, 0x0000000000005dc7,
+	0x5c50e982d45dd44d, 0x85662d5b6fb66466,
+	0x132225746c9be4cc, 0x000000000000d787,
+	0xf66f14c039ba1fba, 0x1fe0fef548bfe04d,
+	0xc7e1b7d8ac76bf64, 0x0000000000003977,
+	0x57899c86b1368106, 0x70ad8047f525aec5,
+	0x0a6bd159d619d675, 0x000000000000b337,
+	0x06daa24ce573df13, 0x3e7df43a76747f33,
+	0x63f8c41f3b1d9666, 0x000000000000e648,
+	0xa73c2a0a6dff41af, 0x51308a88cbee31bb,
+	0xae72a29e4172ff77, 0x0000000000006c08,
+	0xa47cdfd84df96339, 0xa3dd1cc170d7dcdf,
+	0xb0deee92e1151640, 0x0000000000004cb6,
+	0x059a579ec575fd85, 0xcc906273cd4d9257,
+	0x7d5488139b7a7f51, 0x000000000000c6f6,
+	0x54c969549130a390, 0x8240160e4e1c43a1,
+	0x14c79d55767e3f42, 0x0000000000009389,
+	0xf52fe11219bc3d2c, 0xed0d68bcf3860d29,
+	0xd94dfbd40c115653, 0x00000000000019c9,
+	0x524882f0d13ce6bc, 0x679b3a9d386f9969,
+	0x299f054c36b1ed2d, 0x000000000000d2f5,
+	0xf3ae0ab659b07800, 0x08d6442f85f5d7e1,
+	0xe41563cd4cde843c, 0x00000000000058b5,
+	0xa2fd347c0df52615, 0x4606305206a40617,
+	0x8d86768ba1dac42f, 0x0000000000000dca,
+	0x031bbc3a8579b8a9, 0x294b4ee0bb3e489f,
+	0x400c100adbb5ad3e, 0x000000000000878a,
+	0x005b49e8a57f9a3f, 0xdba6d8a90007a5fb,
+	0x5ea05c067bd24409, 0x000000000000a734,
+	0xa1bdc1ae2df30483, 0xb4eba61bbd9deb73,
+	0x932a3a8701bd2d18, 0x0000000000002d74,
+	0xf0eeff6479b65a96, 0xfa3bd2663ecc3a85,
+	0xfab92fc1ecb96d0b, 0x000000000000780b,
+	0x51087722f13ac42a, 0x9576acd48356740d,
+	0x3733494096d6041a, 0x000000000000f24b,
+	0x0d589ea025671067, 0x1010818fece0106b,
+	0x24116c34fa4de0d6, 0x00000000000025cc,
+	0xacbe16e6adeb8edb, 0x7f5dff3d517a5ee3,
+	0xe99b0ab5802289c7, 0x000000000000af8c,
+	0xfded282cf9aed0ce, 0x318d8b40d22b8f15,
+	0x80081ff36d26c9d4, 0x000000000000faf3,
+	0x5c0ba06a71224e72, 0x5ec0f5f26fb1c19d,
+	0x4d8279721749a0c5, 0x00000000000070b3,
+	0x5f4b55b851246ce4, 0xac2d63bbd4882cf9,
+	0x532e357eb72e49f2, 0x000000000000500d,
+	0xfeadddfed9a8f258, 0xc3601d0969126271,
+	0x9ea453ffcd4120e3, 0x000000000000da4d,
+	0xaffee3348dedac4d, 0x8db06974ea43b387,
+	0xf73746b9204560f0, 0x0000000000008f32,
+	0x0e186b72056132f1, 0xe2fd17c657d9fd0f,
+	0x3abd20385a2a09e1, 0x0000000000000572,
+	0xa97f0890cde1e961, 0x686b45e79c30694f,
+	0xca6fdea0608ab29f, 0x000000000000ce4e,
+	0x089980d6456d77dd, 0x07263b5521aa27c7,
+	0x07e5b8211ae5db8e, 0x000000000000440e,
+	0x59cabe1c112829c8, 0x49f64f28a2fbf631,
+	0x6e76ad67f7e19b9d, 0x0000000000001171,
+	0xf82c365a99a4b774, 0x26bb319a1f61b8b9,
+	0xa3fccbe68d8ef28c, 0x0000000000009b31,
+	0xfb6cc388b9a295e2, 0xd456a7d3a45855dd,
+	0xbd5087ea2de91bbb, 0x000000000000bb8f,
+	0x5a8a4bce312e0b5e, 0xbb1bd96119c21b55,
+	0x70dae16b578672aa, 0x00000000000031cf,
+	0x0bd97504656b554b, 0xf5cbad1c9a93caa3,
+	0x1949f42dba8232b9, 0x00000000000064b0,
+	0xaa3ffd42ede7cbf7, 0x9a86d3ae2709842b,
+	0xd4c392acc0ed5ba8, 0x000000000000eef0,
+	0xecde298073743f74, 0x3fc1fdea917fc09b,
+	0x8fc36fb158ed7ec8, 0x00000000000072ef,
+	0x4d38a1c6fbf8a1c8, 0x508c83582ce58e13,
+	0x42490930228217d9, 0x000000000000f8af,
+	0x1c6b9f0cafbdffdd, 0x1e5cf725afb45fe5,
+	0x2bda1c76cf8657ca, 0x000000000000add0,
+	0xbd8d174a27316161, 0x71118997122e116d,
+	0xe6507af7b5e93edb, 0x0000000000002790,
+	0xbecde298073743f7, 0x83fc1fdea917fc09,
+	0xf8fc36fb158ed7ec, 0x000000000000072e,
+	0x1f2b6ade8fbbdd4b, 0xecb1616c148db281,
+	0x3576507a6fe1befd, 0x0000000000008d6e,
+	0x4e785414dbfe835e, 0xa261151197dc6377,
+	0x5ce5453c82e5feee, 0x000000000000d811,
+	0xef9edc5253721de2, 0xcd2c6ba32a462dff,
+	0x916f23bdf88a97ff, 0x0000000000005251,
+	0x48f9bfb09bf2c672, 0x47ba3982e1afb9bf,
+	0x61bddd25c22a2c81, 0x000000000000996d,
+	0xe91f37f6137e58ce, 0x28f747305c35f737,
+	0xac37bba4b8454590, 0x000000000000132d,
+	0xb84c093c473b06db, 0x6627334ddf6426c1,
+	0xc5a4aee255410583, 0x0000000000004652,
+	0x19aa817acfb79867, 0x096a4dff62fe6849,
+	0x082ec8632f2e6c92, 0x000000000000cc12,
+	0x1aea74a8efb1baf1, 0xfb87dbb6d9c7852d,
+	0x1682846f8f4985a5, 0x000000000000ecac,
+	0xbb0cfcee673d244d, 0x94caa504645dcba5,
+	0xdb08e2eef526ecb4, 0x00000000000066ec,
+	0xea5fc22433787a58, 0xda1ad179e70c1a53,
+	0xb29bf7a81822aca7, 0x0000000000003393,
+	0x4bb94a62bbf4e4e4, 0xb557afcb5a9654db,
+	0x7f119129624dc5b6, 0x000000000000b9d3,
+	0x17e9a3e06fa930a9, 0x30318290352030bd,
+	0x6c33b45d0ed6217a, 0x0000000000006e54,
+	0xb60f2ba6e725ae15, 0x5f7cfc2288ba7e35,
+	0xa1b9d2dc74b9486b, 0x000000000000e414,
+	0xe75c156cb360f000, 0x11ac885f0bebafc3,
+	0xc82ac79a99bd0878, 0x000000000000b16b,
+	0x46ba9d2a3bec6ebc, 0x7ee1f6edb671e14b,
+	0x05a0a11be3d26169, 0x0000000000003b2b,
+	0x45fa68f81bea4c2a, 0x8c0c60a40d480c2f,
+	0x1b0ced1743b5885e, 0x0000000000001b95,
+	0xe41ce0be9366d296, 0xe3411e16b0d242a7,
+	0xd6868b9639dae14f, 0x00000000000091d5,
+	0xb54fde74c7238c83, 0xad916a6b33839351,
+	0xbf159ed0d4dea15c, 0x000000000000c4aa,
+	0x14a956324faf123f, 0xc2dc14d98e19ddd9,
+	0x729ff851aeb1c84d, 0x0000000000004eea,
+	0xb3ce35d0872fc9af, 0x484a46f845f04999,
+	0x824d06c994117333, 0x00000000000085d6,
+	0x1228bd960fa35713, 0x2707384af86a0711,
+	0x4fc76048ee7e1a22, 0x0000000000000f96,
+	0x437b835c5be60906, 0x69d74c377b3bd6e7,
+	0x2654750e037a5a31, 0x0000000000005ae9,
+	0xe29d0b1ad36a97ba, 0x069a3285c6a1986f,
+	0xebde138f79153320, 0x000000000000d0a9,
+	0xe1ddfec8f36cb52c, 0xf477a4cc7d98750b,
+	0xf5725f83d972da17, 0x000000000000f017,
+	0x403b768e7be02b90, 0x9b3ada7ec0023b83,
+	0x38f83902a31db306, 0x0000000000007a57,
+	0x116848442fa57585, 0xd5eaae034353ea75,
+	0x516b2c444e19f315, 0x0000000000002f28,
+	0xb08ec002a729eb39, 0xbaa7d0b1fec9a4fd,
+	0x9ce14ac534769a04, 0x000000000000a568,
+	0x1ab13d404ace20ce, 0x2021031fd9c020d6,
+	0x4822d869f49bc1ac, 0x0000000000004b98,
+	0xbb57b506c242be72, 0x4f6c7dad645a6e5e,
+	0x85a8bee88ef4a8bd, 0x000000000000c1d8,
+	0xea048bcc9607e067, 0x01bc09d0e70bbfa8,
+	0xec3babae63f0e8ae, 0x00000000000094a7,
+	0x4be2038a1e8b7edb, 0x6ef177625a91f120,
+	0x21b1cd2f199f81bf, 0x0000000000001ee7,
+	0x48a2f6583e8d5c4d, 0x9c1ce12be1a81c44,
+	0x3f1d8123b9f86888, 0x0000000000003e59,
+	0xe9447e1eb601c2f1, 0xf3519f995c3252cc,
+	0xf297e7a2c3970199, 0x000000000000b419,
+	0xb81740d4e2449ce4, 0xbd81ebe4df63833a,
+	0x9b04f2e42e93418a, 0x000000000000e166,
+	0x19f1c8926ac80258, 0xd2cc955662f9cdb2,
+	0x568e946554fc289b, 0x0000000000006b26,
+	0xbe96ab70a248d9c8, 0x585ac777a91059f2,
+	0xa65c6afd6e5c93e5, 0x000000000000a01a,
+	0x1f7023362ac44774, 0x3717b9c5148a177a,
+	0x6bd60c7c1433faf4, 0x0000000000002a5a,
+	0x4e231dfc7e811961, 0x79c7cdb897dbc68c,
+	0x0245193af937bae7, 0x0000000000007f25,
+	0xefc595baf60d87dd, 0x168ab30a2a418804,
+	0xcfcf7fbb8358d3f6, 0x000000000000f565,
+	0xec856068d60ba54b, 0xe467254391786560,
+	0xd16333b7233f3ac1, 0x000000000000d5db,
+	0x4d63e82e5e873bf7, 0x8b2a5bf12ce22be8,
+	0x1ce95536595053d0, 0x0000000000005f9b,
+	0x1c30d6e40ac265e2, 0xc5fa2f8cafb3fa1e,
+	0x757a4070b45413c3, 0x0000000000000ae4,
+	0xbdd65ea2824efb5e, 0xaab7513e1229b496,
+	0xb8f026f1ce3b7ad2, 0x00000000000080a4,
+	0xe186b72056132f13, 0x2fd17c657d9fd0f0,
+	0xabd20385a2a09e1e, 0x0000000000005723,
+	0x40603f66de9fb1af, 0x409c02d7c0059e78,
+	0x66586504d8cff70f, 0x000000000000dd63,
+	0x113301ac8adaefba, 0x0e4c76aa43544f8e,
+	0x0fcb704235cbb71c, 0x000000000000881c,
+	0xb0d589ea02567106, 0x61010818fece0106,
+	0xc24116c34fa4de0d, 0x000000000000025c,
+	0xb3957c3822505390, 0x93ec9e5145f7ec62,
+	0xdced5acfefc3373a, 0x00000000000022e2,
+	0x1273f47eaadccd2c, 0xfca1e0e3f86da2ea,
+	0x11673c4e95ac5e2b, 0x000000000000a8a2,
+	0x4320cab4fe999339, 0xb271949e7b3c731c,
+	0x78f4290878a81e38, 0x000000000000fddd,
+	0xe2c642f276150d85, 0xdd3cea2cc6a63d94,
+	0xb57e4f8902c77729, 0x000000000000779d,
+	0x45a12110be95d615, 0x57aab80d0d4fa9d4,
+	0x45acb1113867cc57, 0x000000000000bca1,
+	0xe447a956361948a9, 0x38e7c6bfb0d5e75c,
+	0x8826d7904208a546, 0x00000000000036e1,
+	0xb514979c625c16bc, 0x7637b2c2338436aa,
+	0xe1b5c2d6af0ce555, 0x000000000000639e,
+	0x14f21fdaead08800, 0x197acc708e1e7822,
+	0x2c3fa457d5638c44, 0x000000000000e9de,
+	0x17b2ea08cad6aa96, 0xeb975a3935279546,
+	0x3293e85b75046573, 0x000000000000c960,
+	0xb654624e425a342a, 0x84da248b88bddbce,
+	0xff198eda0f6b0c62, 0x0000000000004320,
+	0xe7075c84161f6a3f, 0xca0a50f60bec0a38,
+	0x968a9b9ce26f4c71, 0x000000000000165f,
+	0x46e1d4c29e93f483, 0xa5472e44b67644b0,
+	0x5b00fd1d98002560, 0x0000000000009c1f,
+	0xd9bc5300e6e87ee8, 0x7f83fbd522ff8137,
+	0x1f86df62b1dafd90, 0x000000000000e5df,
+	0x785adb466e64e054, 0x10ce85679f65cfbf,
+	0xd20cb9e3cbb59481, 0x0000000000006f9f,
+	0x2909e58c3a21be41, 0x5e1ef11a1c341e49,
+	0xbb9faca526b1d492, 0x0000000000003ae0,
+	0x88ef6dcab2ad20fd, 0x31538fa8a1ae50c1,
+	0x7615ca245cdebd83, 0x000000000000b0a0,
+	0x8baf981892ab026b, 0xc3be19e11a97bda5,
+	0x68b98628fcb954b4, 0x000000000000901e,
+	0x2a49105e1a279cd7, 0xacf36753a70df32d,
+	0xa533e0a986d63da5, 0x0000000000001a5e,
+	0x7b1a2e944e62c2c2, 0xe223132e245c22db,
+	0xcca0f5ef6bd27db6, 0x0000000000004f21,
+	0xdafca6d2c6ee5c7e, 0x8d6e6d9c99c66c53,
+	0x012a936e11bd14a7, 0x000000000000c561,
+	0x7d9bc5300e6e87ee, 0x07f83fbd522ff813,
+	0xf1f86df62b1dafd9, 0x0000000000000e5d,
+	0xdc7d4d7686e21952, 0x68b5410fefb5b69b,
+	0x3c720b775172c6c8, 0x000000000000841d,
+	0x8d2e73bcd2a74747, 0x266535726ce4676d,
+	0x55e11e31bc7686db, 0x000000000000d162,
+	0x2cc8fbfa5a2bd9fb, 0x49284bc0d17e29e5,
+	0x986b78b0c619efca, 0x0000000000005b22,
+	0x2f880e287a2dfb6d, 0xbbc5dd896a47c481,
+	0x86c734bc667e06fd, 0x0000000000007b9c,
+	0x8e6e866ef2a165d1, 0xd488a33bd7dd8a09,
+	0x4b4d523d1c116fec, 0x000000000000f1dc,
+	0xdf3db8a4a6e43bc4, 0x9a58d746548c5bff,
+	0x22de477bf1152fff, 0x000000000000a4a3,
+	0x7edb30e22e68a578, 0xf515a9f4e9161577,
+	0xef5421fa8b7a46ee, 0x0000000000002ee3,
+	0x228bd960fa357135, 0x707384af86a07111,
+	0xfc76048ee7e1a222, 0x000000000000f964,
+	0x836d512672b9ef89, 0x1f3efa1d3b3a3f99,
+	0x31fc620f9d8ecb33, 0x0000000000007324,
+	0xd23e6fec26fcb19c, 0x51ee8e60b86bee6f,
+	0x586f7749708a8b20, 0x000000000000265b,
+	0x73d8e7aaae702f20, 0x3ea3f0d205f1a0e7,
+	0x95e511c80ae5e231, 0x000000000000ac1b,
+	0x709812788e760db6, 0xcc4e669bbec84d83,
+	0x8b495dc4aa820b06, 0x0000000000008ca5,
+	0xd17e9a3e06fa930a, 0xa30318290352030b,
+	0x46c33b45d0ed6217, 0x00000000000006e5,
+	0x802da4f452bfcd1f, 0xedd36c548003d2fd,
+	0x2f502e033de92204, 0x000000000000539a,
+	0x21cb2cb2da3353a3, 0x829e12e63d999c75,
+	0xe2da488247864b15, 0x000000000000d9da,
+	0x86ac4f5012b38833, 0x080840c7f6700835,
+	0x1208b61a7d26f06b, 0x00000000000012e6,
+	0x274ac7169a3f168f, 0x67453e754bea46bd,
+	0xdf82d09b0749997a, 0x00000000000098a6,
+	0x7619f9dcce7a489a, 0x29954a08c8bb974b,
+	0xb611c5ddea4dd969, 0x000000000000cdd9,
+	0xd7ff719a46f6d626, 0x46d834ba7521d9c3,
+	0x7b9ba35c9022b078, 0x0000000000004799,
+	0xd4bf844866f0f4b0, 0xb435a2f3ce1834a7,
+	0x6537ef503045594f, 0x0000000000006727,
+	0x75590c0eee7c6a0c, 0xdb78dc4173827a2f,
+	0xa8bd89d14a2a305e, 0x000000000000ed67,
+	0x240a32c4ba393419, 0x95a8a83cf0d3abd9,
+	0xc12e9c97a72e704d, 0x000000000000b818,
+	0x85ecba8232b5aaa5, 0xfae5d68e4d49e551,
+	0x0ca4fa16dd41195c, 0x0000000000003258,
+	0x2fd347c0df526152, 0x606305206a40617a,
+	0xd86768ba1dac42f4, 0x000000000000dca8,
+	0x8e35cf8657deffee, 0x0f2e7b92d7da2ff2,
+	0x15ed0e3b67c32be5, 0x00000000000056e8,
+	0xdf66f14c039ba1fb, 0x41fe0fef548bfe04,
+	0x7c7e1b7d8ac76bf6, 0x0000000000000397,
+	0x7e80790a8b173f47, 0x2eb3715de911b08c,
+	0xb1f47dfcf0a802e7, 0x00000000000089d7,
+	0x7dc08cd8ab111dd1, 0xdc5ee71452285de8,
+	0xaf5831f050cfebd0, 0x000000000000a969,
+	0xdc26049e239d836d, 0xb31399a6efb21360,
+	0x62d257712aa082c1, 0x0000000000002329,
+	0x8d753a5477d8dd78, 0xfdc3eddb6ce3c296,
+	0x0b414237c7a4c2d2, 0x0000000000007656,
+	0x2c93b212ff5443c4, 0x928e9369d1798c1e,
+	0xc6cb24b6bdcbabc3, 0x000000000000fc16,
+	0x8bf4d1f037d49854, 0x1818c1481a90185e,
+	0x3619da2e876b10bd, 0x000000000000372a,
+	0x2a1259b6bf5806e8, 0x7755bffaa70a56d6,
+	0xfb93bcaffd0479ac, 0x000000000000bd6a,
+	0x7b41677ceb1d58fd, 0x3985cb87245b8720,
+	0x9200a9e9100039bf, 0x000000000000e815,
+	0xdaa7ef3a6391c641, 0x56c8b53599c1c9a8,
+	0x5f8acf686a6f50ae, 0x0000000000006255,
+	0xd9e71ae84397e4d7, 0xa425237c22f824cc,
+	0x41268364ca08b999, 0x00000000000042eb,
+	0x780192aecb1b7a6b, 0xcb685dce9f626a44,
+	0x8cace5e5b067d088, 0x000000000000c8ab,
+	0x2952ac649f5e247e, 0x85b829b31c33bbb2,
+	0xe53ff0a35d63909b, 0x0000000000009dd4,
+	0x88b4242217d2bac2, 0xeaf55701a1a9f53a,
+	0x28b59622270cf98a, 0x0000000000001794,
+	0xd4e4cda0c38f6e8f, 0x6f937a5ace1f915c,
+	0x3b97b3564b971d46, 0x000000000000c013,
+	0x750245e64b03f033, 0x00de04e87385dfd4,
+	0xf61dd5d731f87457, 0x0000000000004a53,
+	0x24517b2c1f46ae26, 0x4e0e7095f0d40e22,
+	0x9f8ec091dcfc3444, 0x0000000000001f2c,
+	0x85b7f36a97ca309a, 0x21430e274d4e40aa,
+	0x5204a610a6935d55, 0x000000000000956c,
+	0x86f706b8b7cc120c, 0xd3ae986ef677adce,
+	0x4ca8ea1c06f4b462, 0x000000000000b5d2,
+	0x27118efe3f408cb0, 0xbce3e6dc4bede346,
+	0x81228c9d7c9bdd73, 0x0000000000003f92,
+	0x7642b0346b05d2a5, 0xf23392a1c8bc32b0,
+	0xe8b199db919f9d60, 0x0000000000006aed,
+	0xd7a43872e3894c19, 0x9d7eec1375267c38,
+	0x253bff5aebf0f471, 0x000000000000e0ad,
+	0x70c35b902b099789, 0x17e8be32becfe878,
+	0xd5e901c2d1504f0f, 0x0000000000002b91,
+	0xd125d3d6a3850935, 0x78a5c0800355a6f0,
+	0x18636743ab3f261e, 0x000000000000a1d1,
+	0x8076ed1cf7c05720, 0x3675b4fd80047706,
+	0x71f07205463b660d, 0x000000000000f4ae,
+	0x2190655a7f4cc99c, 0x5938ca4f3d9e398e,
+	0xbc7a14843c540f1c, 0x0000000000007eee,
+	0x22d090885f4aeb0a, 0xabd55c0686a7d4ea,
+	0xa2d658889c33e62b, 0x0000000000005e50,
+	0x833618ced7c675b6, 0xc49822b43b3d9a62,
+	0x6f5c3e09e65c8f3a, 0x000000000000d410,
+	0xd265260483832ba3, 0x8a4856c9b86c4b94,
+	0x06cf2b4f0b58cf29, 0x000000000000816f,
+	0x7383ae420b0fb51f, 0xe505287b05f6051c,
+	0xcb454dce7137a638, 0x0000000000000b2f,
+	0x35627a80959c419c, 0x4042063fb38041ac,
+	0x9045b0d3e9378358, 0x0000000000009730,
+	0x9484f2c61d10df20, 0x2f0f788d0e1a0f24,
+	0x5dcfd6529358ea49, 0x0000000000001d70,
+	0xc5d7cc0c49558135, 0x61df0cf08d4bded2,
+	0x345cc3147e5caa5a, 0x000000000000480f,
+	0x6431444ac1d91f89, 0x0e92724230d1905a,
+	0xf9d6a5950433c34b, 0x000000000000c24f,
+	0x6771b198e1df3d1f, 0xfc7fe40b8be87d3e,
+	0xe77ae999a4542a7c, 0x000000000000e2f1,
+	0xc69739de6953a3a3, 0x93329ab9367233b6,
+	0x2af08f18de3b436d, 0x00000000000068b1,
+	0x97c407143d16fdb6, 0xdde2eec4b523e240,
+	0x43639a5e333f037e, 0x0000000000003dce,
+	0x36228f52b59a630a, 0xb2af907608b9acc8,
+	0x8ee9fcdf49506a6f, 0x000000000000b78e,
+	0x9145ecb07d1ab89a, 0x3839c257c3503888,
+	0x7e3b024773f0d111, 0x0000000000007cb2,
+	0x30a364f6f5962626, 0x5774bce57eca7600,
+	0xb3b164c6099fb800, 0x000000000000f6f2,
+	0x61f05a3ca1d37833, 0x19a4c898fd9ba7f6,
+	0xda227180e49bf813, 0x000000000000a38d,
+	0xc016d27a295fe68f, 0x76e9b62a4001e97e,
+	0x17a817019ef49102, 0x00000000000029cd,
+	0xc35627a80959c419, 0x84042063fb38041a,
+	0x09045b0d3e937835, 0x0000000000000973,
+	0x62b0afee81d55aa5, 0xeb495ed146a24a92,
+	0xc48e3d8c44fc1124, 0x0000000000008333,
+	0x33e39124d59004b0, 0xa5992aacc5f39b64,
+	0xad1d28caa9f85137, 0x000000000000d64c,
+	0x920519625d1c9a0c, 0xcad4541e7869d5ec,
+	0x60974e4bd3973826, 0x0000000000005c0c,
+	0xce55f0e089414e41, 0x4fb2794517dfb18a,
+	0x73b56b3fbf0cdcea, 0x0000000000008b8b,
+	0x6fb378a601cdd0fd, 0x20ff07f7aa45ff02,
+	0xbe3f0dbec563b5fb, 0x00000000000001cb,
+	0x3ee0466c55888ee8, 0x6e2f738a29142ef4,
+	0xd7ac18f82867f5e8, 0x00000000000054b4,
+	0x9f06ce2add041054, 0x01620d38948e607c,
+	0x1a267e7952089cf9, 0x000000000000def4,
+	0x9c463bf8fd0232c2, 0xf38f9b712fb78d18,
+	0x048a3275f26f75ce, 0x000000000000fe4a,
+	0x3da0b3be758eac7e, 0x9cc2e5c3922dc390,
+	0xc90054f488001cdf, 0x000000000000740a,
+	0x6cf38d7421cbf26b, 0xd21291be117c1266,
+	0xa09341b265045ccc, 0x0000000000002175,
+	0xcd150532a9476cd7, 0xbd5fef0cace65cee,
+	0x6d1927331f6b35dd, 0x000000000000ab35,
+	0x6a7266d061c7b747, 0x37c9bd2d670fc8ae,
+	0x9dcbd9ab25cb8ea3, 0x0000000000006009,
+	0xcb94ee96e94b29fb, 0x5884c39fda958626,
+	0x5041bf2a5fa4e7b2, 0x000000000000ea49,
+	0x9ac7d05cbd0e77ee, 0x1654b7e259c457d0,
+	0x39d2aa6cb2a0a7a1, 0x000000000000bf36,
+	0x3b21581a3582e952, 0x7919c950e45e1958,
+	0xf458ccedc8cfceb0, 0x0000000000003576,
+	0x3861adc81584cbc4, 0x8bf45f195f67f43c,
+	0xeaf480e168a82787, 0x00000000000015c8,
+	0x9987258e9d085578, 0xe4b921abe2fdbab4,
+	0x277ee66012c74e96, 0x0000000000009f88,
+	0xc8d41b44c94d0b6d, 0xaa6955d661ac6b42,
+	0x4eedf326ffc30e85, 0x000000000000caf7,
+	0x6932930241c195d1, 0xc5242b64dc3625ca,
+	0x836795a785ac6794, 0x00000000000040b7,
+	0xc30d6e40ac265e26, 0x5fa2f8cafb3fa1e1,
+	0x57a4070b45413c3c, 0x000000000000ae47,
+	0x62ebe60624aac09a, 0x30ef867846a5ef69,
+	0x9a2e618a3f2e552d, 0x0000000000002407,
+	0x33b8d8cc70ef9e8f, 0x7e3ff205c5f43e9f,
+	0xf3bd74ccd22a153e, 0x0000000000007178,
+	0x925e508af8630033, 0x11728cb7786e7017,
+	0x3e37124da8457c2f, 0x000000000000fb38,
+	0x911ea558d86522a5, 0xe39f1afec3579d73,
+	0x209b5e4108229518, 0x000000000000db86,
+	0x30f82d1e50e9bc19, 0x8cd2644c7ecdd3fb,
+	0xed1138c0724dfc09, 0x00000000000051c6,
+	0x61ab13d404ace20c, 0xc2021031fd9c020d,
+	0x84822d869f49bc1a, 0x00000000000004b9,
+	0xc04d9b928c207cb0, 0xad4f6e8340064c85,
+	0x49084b07e526d50b, 0x0000000000008ef9,
+	0x672af87044a0a720, 0x27d93ca28befd8c5,
+	0xb9dab59fdf866e75, 0x00000000000045c5,
+	0xc6cc7036cc2c399c, 0x489442103675964d,
+	0x7450d31ea5e90764, 0x000000000000cf85,
+	0x979f4efc98696789, 0x0644366db52447bb,
+	0x1dc3c65848ed4777, 0x0000000000009afa,
+	0x3679c6ba10e5f935, 0x690948df08be0933,
+	0xd049a0d932822e66, 0x00000000000010ba,
+	0x3539336830e3dba3, 0x9be4de96b387e457,
+	0xcee5ecd592e5c751, 0x0000000000003004,
+	0x94dfbb2eb86f451f, 0xf4a9a0240e1daadf,
+	0x036f8a54e88aae40, 0x000000000000ba44,
+	0xc58c85e4ec2a1b0a, 0xba79d4598d4c7b29,
+	0x6afc9f12058eee53, 0x000000000000ef3b,
+	0x646a0da264a685b6, 0xd534aaeb30d635a1,
+	0xa776f9937fe18742, 0x000000000000657b,
+	0x383ae420b0fb51fb, 0x505287b05f6051c7,
+	0xb454dce7137a638e, 0x000000000000b2fc,
+	0x99dc6c663877cf47, 0x3f1ff902e2fa1f4f,
+	0x79deba6669150a9f, 0x00000000000038bc,
+	0xc88f52ac6c329152, 0x71cf8d7f61abceb9,
+	0x104daf2084114a8c, 0x0000000000006dc3,
+	0x6969daeae4be0fee, 0x1e82f3cddc318031,
+	0xddc7c9a1fe7e239d, 0x000000000000e783,
+	0x6a292f38c4b82d78, 0xec6f658467086d55,
+	0xc36b85ad5e19caaa, 0x000000000000c73d,
+	0xcbcfa77e4c34b3c4, 0x83221b36da9223dd,
+	0x0ee1e32c2476a3bb, 0x0000000000004d7d,
+	0x9a9c99b41871edd1, 0xcdf26f4b59c3f22b,
+	0x6772f66ac972e3a8, 0x0000000000001802,
+	0x3b7a11f290fd736d, 0xa2bf11f9e459bca3,
+	0xaaf890ebb31d8ab9, 0x0000000000009242,
+	0x9c1d7210587da8fd, 0x282943d82fb028e3,
+	0x5a2a6e7389bd31c7, 0x000000000000597e,
+	0x3dfbfa56d0f13641, 0x47643d6a922a666b,
+	0x97a008f2f3d258d6, 0x000000000000d33e,
+	0x6ca8c49c84b46854, 0x09b44917117bb79d,
+	0xfe331db41ed618c5, 0x0000000000008641,
+	0xcd4e4cda0c38f6e8, 0x66f937a5ace1f915,
+	0x33b97b3564b971d4, 0x0000000000000c01,
+	0xce0eb9082c3ed47e, 0x9414a1ec17d81471,
+	0x2d153739c4de98e3, 0x0000000000002cbf,
+	0x6fe8314ea4b24ac2, 0xfb59df5eaa425af9,
+	0xe09f51b8beb1f1f2, 0x000000000000a6ff,
+	0x3ebb0f84f0f714d7, 0xb589ab2329138b0f,
+	0x890c44fe53b5b1e1, 0x000000000000f380,
+	0x9f5d87c2787b8a6b, 0xdac4d5919489c587,
+	0x4486227f29dad8f0, 0x00000000000079c0,
+};
+#endif
+
+const struct bch_def bch_16bit = {
+	.syns		= 32,
+	.generator	= { 0xb378a601cdd0fdd1, 0xff07f7aa45ff026f,
+			    0x3f0dbec563b5fb20, 0x1cbbe },
+	.degree		= 208,
+	.ecc_bytes	= 26,
+	.table		= BCH_TABLE(bch_16bit_table)
+};
@@ -0,0 +1,297 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include "bch.h"
+
+/* 1-bit ECC over GF(2^13). Each code has its own file, so that only
+ * the tables for codes in use are linked.
+ */
+
+#ifndef BCH_NO_TABLES
+/* Slice-by-4 remainder table, generated with tools/gentab from the
+ * generator polynomial (shifted right by one bit). The degree is under
+ * 32, so 32-bit entries suffice.
+ */
+static const uint32_t bch_1bit_table[BCH_TABLE_SIZE] = {
+	0x00000000, 0x000018eb, 0x000011cd, 0x00000926,
+	0x00000381, 0x00001b6a, 0x0000124c, 0x00000aa7,
+	0x00000702, 0x00001fe9, 0x000016cf, 0x00000e24,
+	0x00000483, 0x00001c68, 0x0000154e, 0x00000da5,
+	0x00000e04, 0x000016ef, 0x00001fc9, 0x00000722,
+	0x00000d85, 0x0000156e, 0x00001c48, 0x000004a3,
+	0x00000906, 0x000011ed, 0x000018cb, 0x00000020,
+	0x00000a87, 0x0000126c, 0x00001b4a, 0x000003a1,
+	0x00001c08, 0x000004e3, 0x00000dc5, 0x0000152e,
+	0x00001f89, 0x00000762, 0x00000e44, 0x000016af,
+	0x00001b0a, 0x000003e1, 0x00000ac7, 0x0000122c,
+	0x0000188b, 0x00000060, 0x00000946, 0x000011ad,
+	0x0000120c, 0x00000ae7, 0x000003c1, 0x00001b2a,
+	0x0000118d, 0x00000966, 0x00000040, 0x000018ab,
+	0x0000150e, 0x00000de5, 0x000004c3, 0x00001c28,
+	0x0000168f, 0x00000e64, 0x00000742, 0x00001fa9,
+	0x0000180b, 0x000000e0, 0x000009c6, 0x0000112d,
+	0x00001b8a, 0x00000361, 0x00000a47, 0x000012ac,
+	0x00001f09, 0x000007e2, 0x00000ec4, 0x0000162f,
+	0x00001c88, 0x00000463, 0x00000d45, 0x000015ae,
+	0x0000160f, 0x00000ee4, 0x000007c2, 0x00001f29,
+	0x0000158e, 0x00000d65, 0x00000443, 0x00001ca8,
+	0x0000110d, 0x000009e6, 0x000000c0, 0x0000182b,
+	0x0000128c, 0x00000a67, 0x00000341, 0x00001baa,
+	0x00000403, 0x00001ce8, 0x000015ce, 0x00000d25,
+	0x00000782, 0x00001f69, 0x0000164f, 0x00000ea4,
+	0x00000301, 0x00001bea, 0x000012cc, 0x00000a27,
+	0x00000080, 0x0000186b, 0x0000114d, 0x000009a6,
+	0x00000a07, 0x000012ec, 0x00001bca, 0x00000321,
+	0x00000986, 0x0000116d, 0x0000184b, 0x000000a0,
+	0x00000d05, 0x000015ee, 0x00001cc8, 0x00000423,
+	0x00000e84, 0x0000166f, 0x00001f49, 0x000007a2,
+	0x0000100d, 0x000008e6, 0x000001c0, 0x0000192b,
+	0x0000138c, 0x00000b67, 0x00000241, 0x00001aaa,
+	0x0000170f, 0x00000fe4, 0x000006c2, 0x00001e29,
+	0x0000148e, 0x00000c65, 0x00000543, 0x00001da8,
+	0x00001e09, 0x000006e2, 0x00000fc4, 0x0000172f,
+	0x00001d88, 0x00000563, 0x00000c45, 0x000014ae,
+	0x0000190b, 0x000001e0, 0x000008c6, 0x0000102d,
+	0x00001a8a, 0x00000261, 0x00000b47, 0x000013ac,
+	0x00000c05, 0x000014ee, 0x00001dc8, 0x00000523,
+	0x00000f84, 0x0000176f, 0x00001e49, 0x000006a2,
+	0x00000b07, 0x000013ec, 0x00001aca, 0x00000221,
+	0x00000886, 0x0000106d, 0x0000194b, 0x000001a0,
+	0x00000201, 0x00001aea, 0x000013cc, 0x00000b27,
+	0x00000180, 0x0000196b, 0x0000104d, 0x000008a6,
+	0x00000503, 0x00001de8, 0x000014ce, 0x00000c25,
+	0x00000682, 0x00001e69, 0x0000174f, 0x00000fa4,
+	0x00000806, 0x000010ed, 0x000019cb, 0x00000120,
+	0x00000b87, 0x0000136c, 0x00001a4a, 0x000002a1,
+	0x00000f04, 0x000017ef, 0x00001ec9, 0x00000622,
+	0x00000c85, 0x0000146e, 0x00001d48, 0x000005a3,
+	0x00000602, 0x00001ee9, 0x000017cf, 0x00000f24,
+	0x00000583, 0x00001d68, 0x0000144e, 0x00000ca5,
+	0x00000100, 0x000019eb, 0x000010cd, 0x00000826,
+	0x00000281, 0x00001a6a, 0x0000134c, 0x00000ba7,
+	0x0000140e, 0x00000ce5, 0x000005c3, 0x00001d28,
+	0x0000178f, 0x00000f64, 0x00000642, 0x00001ea9,
+	0x0000130c, 0x00000be7, 0x000002c1, 0x00001a2a,
+	0x0000108d, 0x00000866, 0x00000140, 0x000019ab,
+	0x00001a0a, 0x000002e1, 0x00000bc7, 0x0000132c,
+	0x0000198b, 0x00000160, 0x00000846, 0x000010ad,
+	0x00001d08, 0x000005e3, 0x00000cc5, 0x0000142e,
+	0x00001e89, 0x00000662, 0x00000f44, 0x000017af,
+	0x00000000, 0x00001a32, 0x0000147f, 0x00000e4d,
+	0x000008e5, 0x000012d7, 0x00001c9a, 0x000006a8,
+	0x000011ca, 0x00000bf8, 0x000005b5, 0x00001f87,
+	0x0000192f, 0x0000031d, 0x00000d50, 0x00001762,
+	0x0000038f, 0x000019bd, 0x000017f0, 0x00000dc2,
+	0x00000b6a, 0x00001158, 0x00001f15, 0x00000527,
+	0x00001245, 0x00000877, 0x0000063a, 0x00001c08,
+	0x00001aa0, 0x00000092, 0x00000edf, 0x000014ed,
+	0x0000071e, 0x00001d2c, 0x00001361, 0x00000953,
+	0x00000ffb, 0x000015c9, 0x00001b84, 0x000001b6,
+	0x000016d4, 0x00000ce6, 0x000002ab, 0x00001899,
+	0x00001e31, 0x00000403, 0x00000a4e, 0x0000107c,
+	0x00000491, 0x00001ea3, 0x000010ee, 0x00000adc,
+	0x00000c74, 0x00001646, 0x0000180b, 0x00000239,
+	0x0000155b, 0x00000f69, 0x00000124, 0x00001b16,
+	0x00001dbe, 0x0000078c, 0x000009c1, 0x000013f3,
+	0x00000e3c, 0x0000140e, 0x00001a43, 0x00000071,
+	0x000006d9, 0x00001ceb, 0x000012a6, 0x00000894,
+	0x00001ff6, 0x000005c4, 0x00000b89, 0x000011bb,
+	0x00001713, 0x00000d21, 0x0000036c, 0x0000195e,
+	0x00000db3, 0x00001781, 0x000019cc, 0x000003fe,
+	0x00000556, 0x00001f64, 0x00001129, 0x00000b1b,
+	0x00001c79, 0x0000064b, 0x00000806, 0x00001234,
+	0x0000149c, 0x00000eae, 0x000000e3, 0x00001ad1,
+	0x00000922, 0x00001310, 0x00001d5d, 0x0000076f,
+	0x000001c7, 0x00001bf5, 0x000015b8, 0x00000f8a,
+	0x000018e8, 0x000002da, 0x00000c97, 0x000016a5,
+	0x0000100d, 0x00000a3f, 0x00000472, 0x00001e40,
+	0x00000aad, 0x0000109f, 0x00001ed2, 0x000004e0,
+	0x00000248, 0x0000187a, 0x00001637, 0x00000c05,
+	0x00001b67, 0x00000155, 0x00000f18, 0x0000152a,
+	0x00001382, 0x000009b0, 0x000007fd, 0x00001dcf,
+	0x00001c78, 0x0000064a, 0x00000807, 0x00001235,
+	0x0000149d, 0x00000eaf, 0x000000e2, 0x00001ad0,
+	0x00000db2, 0x00001780, 0x000019cd, 0x000003ff,
+	0x00000557, 0x00001f65, 0x00001128, 0x00000b1a,
+	0x00001ff7, 0x000005c5, 0x00000b88, 0x000011ba,
+	0x00001712, 0x00000d20, 0x0000036d, 0x0000195f,
+	0x00000e3d, 0x0000140f, 0x00001a42, 0x00000070,
+	0x000006d8, 0x00001cea, 0x000012a7, 0x00000895,
+	0x00001b66, 0x00000154, 0x00000f19, 0x0000152b,
+	0x00001383, 0x000009b1, 0x000007fc, 0x00001dce,
+	0x00000aac, 0x0000109e, 0x00001ed3, 0x000004e1,
+	0x00000249, 0x0000187b, 0x00001636, 0x00000c04,
+	0x000018e9, 0x000002db, 0x00000c96, 0x000016a4,
+	0x0000100c, 0x00000a3e, 0x00000473, 0x00001e41,
+	0x00000923, 0x00001311, 0x00001d5c, 0x0000076e,
+	0x000001c6, 0x00001bf4, 0x000015b9, 0x00000f8b,
+	0x00001244, 0x00000876, 0x0000063b, 0x00001c09,
+	0x00001aa1, 0x00000093, 0x00000ede, 0x000014ec,
+	0x0000038e, 0x000019bc, 0x000017f1, 0x00000dc3,
+	0x00000b6b, 0x00001159, 0x00001f14, 0x00000526,
+	0x000011cb, 0x00000bf9, 0x000005b4, 0x00001f86,
+	0x0000192e, 0x0000031c, 0x00000d51, 0x00001763,
+	0x00000001, 0x00001a33, 0x0000147e, 0x00000e4c,
+	0x000008e4, 0x000012d6, 0x00001c9b, 0x000006a9,
+	0x0000155a, 0x00000f68, 0x00000125, 0x00001b17,
+	0x00001dbf, 0x0000078d, 0x000009c0, 0x000013f2,
+	0x00000490, 0x00001ea2, 0x000010ef, 0x00000add,
+	0x00000c75, 0x00001647, 0x0000180a, 0x00000238,
+	0x000016d5, 0x00000ce7, 0x000002aa, 0x00001898,
+	0x00001e30, 0x00000402, 0x00000a4f, 0x0000107d,
+	0x0000071f, 0x00001d2d, 0x00001360, 0x00000952,
+	0x00000ffa, 0x000015c8, 0x00001b85, 0x000001b7,
+	0x00000000, 0x000003db, 0x000007b6, 0x0000046d,
+	0x00000f6c, 0x00000cb7, 0x000008da, 0x00000b01,
+	0x00001ed8, 0x00001d03, 0x0000196e, 0x00001ab5,
+	0x000011b4, 0x0000126f, 0x00001602, 0x000015d9,
+	0x00001dab, 0x00001e70, 0x00001a1d, 0x000019c6,
+	0x000012c7, 0x0000111c, 0x00001571, 0x000016aa,
+	0x00000373, 0x000000a8, 0x000004c5, 0x0000071e,
+	0x00000c1f, 0x00000fc4, 0x00000ba9, 0x00000872,
+	0x00001b4d, 0x00001896, 0x00001cfb, 0x00001f20,
+	0x00001421, 0x000017fa, 0x00001397, 0x0000104c,
+	0x00000595, 0x0000064e, 0x00000223, 0x000001f8,
+	0x00000af9, 0x00000922, 0x00000d4f, 0x00000e94,
+	0x000006e6, 0x0000053d, 0x00000150, 0x0000028b,
+	0x0000098a, 0x00000a51, 0x00000e3c, 0x00000de7,
+	0x0000183e, 0x00001be5, 0x00001f88, 0x00001c53,
+	0x00001752, 0x00001489, 0x000010e4, 0x0000133f,
+	0x00001681, 0x0000155a, 0x00001137, 0x000012ec,
+	0x000019ed, 0x00001a36, 0x00001e5b, 0x00001d80,
+	0x00000859, 0x00000b82, 0x00000fef, 0x00000c34,
+	0x00000735, 0x000004ee, 0x00000083, 0x00000358,
+	0x00000b2a, 0x000008f1, 0x00000c9c, 0x00000f47,
+	0x00000446, 0x0000079d, 0x000003f0, 0x0000002b,
+	0x000015f2, 0x00001629, 0x00001244, 0x0000119f,
+	0x00001a9e, 0x00001945, 0x00001d28, 0x00001ef3,
+	0x00000dcc, 0x00000e17, 0x00000a7a, 0x000009a1,
+	0x000002a0, 0x0000017b, 0x00000516, 0x000006cd,
+	0x00001314, 0x000010cf, 0x000014a2, 0x00001779,
+	0x00001c78, 0x00001fa3, 0x00001bce, 0x00001815,
+	0x00001067, 0x000013bc, 0x000017d1, 0x0000140a,
+	0x00001f0b, 0x00001cd0, 0x000018bd, 0x00001b66,
+	0x00000ebf, 0x00000d64, 0x00000909, 0x00000ad2,
+	0x000001d3, 0x00000208, 0x00000665, 0x000005be,
+	0x00000d19, 0x00000ec2, 0x00000aaf, 0x00000974,
+	0x00000275, 0x000001ae, 0x000005c3, 0x00000618,
+	0x000013c1, 0x0000101a, 0x00001477, 0x000017ac,
+	0x00001cad, 0x00001f76, 0x00001b1b, 0x000018c0,
+	0x000010b2, 0x00001369, 0x00001704, 0x000014df,
+	0x00001fde, 0x00001c05, 0x00001868, 0x00001bb3,
+	0x00000e6a, 0x00000db1, 0x000009dc, 0x00000a07,
+	0x00000106, 0x000002dd, 0x000006b0, 0x0000056b,
+	0x00001654, 0x0000158f, 0x000011e2, 0x00001239,
+	0x00001938, 0x00001ae3, 0x00001e8e, 0x00001d55,
+	0x0000088c, 0x00000b57, 0x00000f3a, 0x00000ce1,
+	0x000007e0, 0x0000043b, 0x00000056, 0x0000038d,
+	0x00000bff, 0x00000824, 0x00000c49, 0x00000f92,
+	0x00000493, 0x00000748, 0x00000325, 0x000000fe,
+	0x00001527, 0x000016fc, 0x00001291, 0x0000114a,
+	0x00001a4b, 0x00001990, 0x00001dfd, 0x00001e26,
+	0x00001b98, 0x00001843, 0x00001c2e, 0x00001ff5,
+	0x000014f4, 0x0000172f, 0x00001342, 0x00001099,
+	0x00000540, 0x0000069b, 0x000002f6, 0x0000012d,
+	0x00000a2c, 0x000009f7, 0x00000d9a, 0x00000e41,
+	0x00000633, 0x000005e8, 0x00000185, 0x0000025e,
+	0x0000095f, 0x00000a84, 0x00000ee9, 0x00000d32,
+	0x000018eb, 0x00001b30, 0x00001f5d, 0x00001c86,
+	0x00001787, 0x0000145c, 0x00001031, 0x000013ea,
+	0x000000d5, 0x0000030e, 0x00000763, 0x000004b8,
+	0x00000fb9, 0x00000c62, 0x0000080f, 0x00000bd4,
+	0x00001e0d, 0x00001dd6, 0x000019bb, 0x00001a60,
+	0x00001161, 0x000012ba, 0x000016d7, 0x0000150c,
+	0x00001d7e, 0x00001ea5, 0x00001ac8, 0x00001913,
+	0x00001212, 0x000011c9, 0x000015a4, 0x0000167f,
+	0x000003a6, 0x0000007d, 0x00000410, 0x000007cb,
+	0x00000cca, 0x00000f11, 0x00000b7c, 0x000008a7,
+	0x00000000, 0x00000825, 0x0000104a, 0x0000186f,
+	0x0000008f, 0x000008aa, 0x000010c5, 0x000018e0,
+	0x0000011e, 0x0000093b, 0x00001154, 0x00001971,
+	0x00000191, 0x000009b4, 0x000011db, 0x000019fe,
+	0x0000023c, 0x00000a19, 0x00001276, 0x00001a53,
+	0x000002b3, 0x00000a96, 0x000012f9, 0x00001adc,
+	0x00000322, 0x00000b07, 0x00001368, 0x00001b4d,
+	0x000003ad, 0x00000b88, 0x000013e7, 0x00001bc2,
+	0x00000478, 0x00000c5d, 0x00001432, 0x00001c17,
+	0x000004f7, 0x00000cd2, 0x000014bd, 0x00001c98,
+	0x00000566, 0x00000d43, 0x0000152c, 0x00001d09,
+	0x000005e9, 0x00000dcc, 0x000015a3, 0x00001d86,
+	0x00000644, 0x00000e61, 0x0000160e, 0x00001e2b,
+	0x000006cb, 0x00000eee, 0x00001681, 0x00001ea4,
+	0x0000075a, 0x00000f7f, 0x00001710, 0x00001f35,
+	0x000007d5, 0x00000ff0, 0x0000179f, 0x00001fba,
+	0x000008f0, 0x000000d5, 0x000018ba, 0x0000109f,
+	0x0000087f, 0x0000005a, 0x00001835, 0x00001010,
+	0x000009ee, 0x000001cb, 0x000019a4, 0x00001181,
+	0x00000961, 0x00000144, 0x0000192b, 0x0000110e,
+	0x00000acc, 0x000002e9, 0x00001a86, 0x000012a3,
+	0x00000a43, 0x00000266, 0x00001a09, 0x0000122c,
+	0x00000bd2, 0x000003f7, 0x00001b98, 0x000013bd,
+	0x00000b5d, 0x00000378, 0x00001b17, 0x00001332,
+	0x00000c88, 0x000004ad, 0x00001cc2, 0x000014e7,
+	0x00000c07, 0x00000422, 0x00001c4d, 0x00001468,
+	0x00000d96, 0x000005b3, 0x00001ddc, 0x000015f9,
+	0x00000d19, 0x0000053c, 0x00001d53, 0x00001576,
+	0x00000eb4, 0x00000691, 0x00001efe, 0x000016db,
+	0x00000e3b, 0x0000061e, 0x00001e71, 0x00001654,
+	0x00000faa, 0x0000078f, 0x00001fe0, 0x000017c5,
+	0x00000f25, 0x00000700, 0x00001f6f, 0x0000174a,
+	0x000011e0, 0x000019c5, 0x000001aa, 0x0000098f,
+	0x0000116f, 0x0000194a, 0x00000125, 0x00000900,
+	0x000010fe, 0x000018db, 0x000000b4, 0x00000891,
+	0x00001071, 0x00001854, 0x0000003b, 0x0000081e,
+	0x000013dc, 0x00001bf9, 0x00000396, 0x00000bb3,
+	0x00001353, 0x00001b76, 0x00000319, 0x00000b3c,
+	0x000012c2, 0x00001ae7, 0x00000288, 0x00000aad,
+	0x0000124d, 0x00001a68, 0x00000207, 0x00000a22,
+	0x00001598, 0x00001dbd, 0x000005d2, 0x00000df7,
+	0x00001517, 0x00001d32, 0x0000055d, 0x00000d78,
+	0x00001486, 0x00001ca3, 0x000004cc, 0x00000ce9,
+	0x00001409, 0x00001c2c, 0x00000443, 0x00000c66,
+	0x000017a4, 0x00001f81, 0x000007ee, 0x00000fcb,
+	0x0000172b, 0x00001f0e, 0x00000761, 0x00000f44,
+	0x000016ba, 0x00001e9f, 0x000006f0, 0x00000ed5,
+	0x00001635, 0x00001e10, 0x0000067f, 0x00000e5a,
+	0x00001910, 0x00001135, 0x0000095a, 0x0000017f,
+	0x0000199f, 0x000011ba, 0x000009d5, 0x000001f0,
+	0x0000180e, 0x0000102b, 0x00000844, 0x00000061,
+	0x00001881, 0x000010a4, 0x000008cb, 0x000000ee,
+	0x00001b2c, 0x00001309, 0x00000b66, 0x00000343,
+	0x00001ba3, 0x00001386, 0x00000be9, 0x000003cc,
+	0x00001a32, 0x00001217, 0x00000a78, 0x0000025d,
+	0x00001abd, 0x00001298, 0x00000af7, 0x000002d2,
+	0x00001d68, 0x0000154d, 0x00000d22, 0x00000507,
+	0x00001de7, 0x000015c2, 0x00000dad, 0x00000588,
+	0x00001c76, 0x00001453, 0x00000c3c, 0x00000419,
+	0x00001cf9, 0x000014dc, 0x00000cb3, 0x00000496,
+	0x00001f54, 0x00001771, 0x00000f1e, 0x0000073b,
+	0x00001fdb, 0x000017fe, 0x00000f91, 0x000007b4,
+	0x00001e4a, 0x0000166f, 0x00000e00, 0x00000625,
+	0x00001ec5, 0x000016e0, 0x00000e8f, 0x000006aa,
+};
+#endif
+
+const struct bch_def bch_1bit = {
+	.syns		= 2,
+	.generator	= { 0x201b },
+	.degree		= 13,
+	.ecc_bytes	= 2,
+	.table32	= BCH_TABLE(bch_1bit_table),
+	.fold		= { 0x43d8000000000000, 0x6bd8000000000000,
+			    0xf9d8000000000000, 0x0be0000000000000 }
+};
@@ -0,0 +1,849 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include "bch.h"
+#include "gf14.h"
+
+/* 24-bit ECC over GF(2^14). Each code has its own file, so that only
+ * the tables for codes in use are linked. This one also brings in the
+ * GF(2^14) arithmetic.
+ */
+
+static uint16_t mul14(uint16_t a, uint16_t b)
+{
+	return gf14_mul(a, b);
+}
+
+static uint16_t div14(uint16_t a, uint16_t b)
+{
+	return gf14_div(a, b);
+}
+
+static uint16_t mulx14(uint16_t a)
+{
+	return gf14_mulx(a);
+}
+
+static uint16_t divx14(uint16_t a)
+{
+	return gf14_divx(a);
+}
+
+#ifndef GF14_NO_TABLES
+static int log14(uint16_t a)
+{
+	return gf14_wrap(gf14_log[a]);
+}
+#endif
+
+static const struct bch_field gf14 = {
+	.order		= GF14_ORDER,
+	.mul		= mul14,
+	.div		= div14,
+	.mulx		= mulx14,
+	.divx		= divx14,
+#ifndef GF14_NO_TABLES
+	.log		= log14
+#endif
+};
+
+#ifndef BCH_NO_TABLES
+/* Byte-wise remainder table, generated with tools/gentab from the
+ * generator polynomial (shifted right by one bit).
+ */
+static const bch_poly_t bch_24bit_table[256 * 6] = {
+	0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000,
+	0xbbe9bda133b45814, 0xeb14477ebd67cfca,
+	0xb2738bc56eb3cbc9, 0xdf636b0f00a6141b,
+	0xf1272c726bcdfe7b, 0x000000000000574c,
+	0x77d37b426768b028, 0xd6288efd7acf9f95,
+	0x64e7178add679793, 0xbec6d61e014c2837,
+	0xe24e58e4d79bfcf7, 0x000000000000ae99,
+	0xcc3ac6e354dce83c, 0x3d3cc983c7a8505f,
+	0xd6949c4fb3d45c5a, 0x61a5bd1101ea3c2c,
+	0x13697496bc56028c, 0x000000000000f9d5,
+	0x3efd302307661365, 0x0cc2add5d8cae644,
+	0x1cb92d3f6d8b7d56, 0x5fb6f4a6827e95a8,
+	0xe825cc861c418320, 0x000000000000df20,
+	0x85148d8234d24b71, 0xe7d6eaab65ad298e,
+	0xaecaa6fa0338b69f, 0x80d59fa982d881b3,
+	0x1902e0f4778c7d5b, 0x000000000000886c,
+	0x492e4b61600ea34d, 0xdaea2328a20579d1,
+	0x785e3ab5b0eceac5, 0xe17022b88332bd9f,
+	0x0a6b9462cbda7fd7, 0x00000000000071b9,
+	0xf2c7f6c053bafb59, 0x31fe64561f62b61b,
+	0xca2db170de5f210c, 0x3e1349b78394a984,
+	0xfb4cb810a01781ac, 0x00000000000026f5,
+	0xaca1a6e1c77b55ff, 0xb916eb849cc015e6,
+	0xec0558540c52a8dd, 0x9d56b1d7841bee96,
+	0xfcf2e4438bf57c8f, 0x0000000000003c52,
+	0x17481b40f4cf0deb, 0x5202acfa21a7da2c,
+	0x5e76d39162e16314, 0x4235dad884bdfa8d,
+	0x0dd5c831e03882f4, 0x0000000000006b1e,
+	0xdb72dda3a013e5d7, 0x6f3e6579e60f8a73,
+	0x88e24fded1353f4e, 0x239067c98557c6a1,
+	0x1ebcbca75c6e8078, 0x00000000000092cb,
+	0x609b600293a7bdc3, 0x842a22075b6845b9,
+	0x3a91c41bbf86f487, 0xfcf30cc685f1d2ba,
+	0xef9b90d537a37e03, 0x000000000000c587,
+	0x925c96c2c01d469a, 0xb5d44651440af3a2,
+	0xf0bc756b61d9d58b, 0xc2e0457106657b3e,
+	0x14d728c597b4ffaf, 0x000000000000e372,
+	0x29b52b63f3a91e8e, 0x5ec0012ff96d3c68,
+	0x42cffeae0f6a1e42, 0x1d832e7e06c36f25,
+	0xe5f004b7fc7901d4, 0x000000000000b43e,
+	0xe58fed80a775f6b2, 0x63fcc8ac3ec56c37,
+	0x945b62e1bcbe4218, 0x7c26936f07295309,
+	0xf6997021402f0358, 0x0000000000004deb,
+	0x5e66502194c1aea6, 0x88e88fd283a2a3fd,
+	0x2628e924d20d89d1, 0xa345f860078f4712,
+	0x07be5c532be2fd23, 0x0000000000001aa7,
+	0x59434dc38ef6abfe, 0x722dd70939802bcd,
+	0xd80ab0a818a551bb, 0x3aad63af0837dd2d,
+	0xf9e5c88717eaf91f, 0x00000000000078a5,
+	0xe2aaf062bd42f3ea, 0x9939907784e7e407,
+	0x6a793b6d76169a72, 0xe5ce08a00891c936,
+	0x08c2e4f57c270764, 0x0000000000002fe9,
+	0x2e903681e99e1bd6, 0xa40559f4434fb458,
+	0xbceda722c5c2c628, 0x846bb5b1097bf51a,
+	0x1bab9063c07105e8, 0x000000000000d63c,
+	0x95798b20da2a43c2, 0x4f111e8afe287b92,
+	0x0e9e2ce7ab710de1, 0x5b08debe09dde101,
+	0xea8cbc11abbcfb93, 0x0000000000008170,
+	0x67be7de08990b89b, 0x7eef7adce14acd89,
+	0xc4b39d97752e2ced, 0x651b97098a494885,
+	0x11c004010bab7a3f, 0x000000000000a785,
+	0xdc57c041ba24e08f, 0x95fb3da25c2d0243,
+	0x76c016521b9de724, 0xba78fc068aef5c9e,
+	0xe0e7287360668444, 0x000000000000f0c9,
+	0x106d06a2eef808b3, 0xa8c7f4219b85521c,
+	0xa0548a1da849bb7e, 0xdbdd41178b0560b2,
+	0xf38e5ce5dc3086c8, 0x000000000000091c,
+	0xab84bb03dd4c50a7, 0x43d3b35f26e29dd6,
+	0x122701d8c6fa70b7, 0x04be2a188ba374a9,
+	0x02a97097b7fd78b3, 0x0000000000005e50,
+	0xf5e2eb22498dfe01, 0xcb3b3c8da5403e2b,
+	0x340fe8fc14f7f966, 0xa7fbd2788c2c33bb,
+	0x05172cc49c1f8590, 0x00000000000044f7,
+	0x4e0b56837a39a615, 0x202f7bf31827f1e1,
+	0x867c63397a4432af, 0x7898b9778c8a27a0,
+	0xf43000b6f7d27beb, 0x00000000000013bb,
+	0x823190602ee54e29, 0x1d13b270df8fa1be,
+	0x50e8ff76c9906ef5, 0x193d04668d601b8c,
+	0xe75974204b847967, 0x000000000000ea6e,
+	0x39d82dc11d51163d, 0xf607f50e62e86e74,
+	0xe29b74b3a723a53c, 0xc65e6f698dc60f97,
+	0x167e58522049871c, 0x000000000000bd22,
+	0xcb1fdb014eebed64, 0xc7f991587d8ad86f,
+	0x28b6c5c3797c8430, 0xf84d26de0e52a613,
+	0xed32e042805e06b0, 0x0000000000009bd7,
+	0x70f666a07d5fb570, 0x2cedd626c0ed17a5,
+	0x9ac54e0617cf4ff9, 0x272e4dd10ef4b208,
+	0x1c15cc30eb93f8cb, 0x000000000000cc9b,
+	0xbccca04329835d4c, 0x11d11fa5074547fa,
+	0x4c51d249a41b13a3, 0x468bf0c00f1e8e24,
+	0x0f7cb8a657c5fa47, 0x000000000000354e,
+	0x07251de21a370558, 0xfac558dbba228830,
+	0xfe22598ccaa8d86a, 0x99e89bcf0fb89a3f,
+	0xfe5b94d43c08043c, 0x0000000000006202,
+	0xb2869b871ded57fc, 0xe45bae127300579a,
+	0xb0156150314aa376, 0x755ac75e106fba5b,
+	0xf3cb910e2fd5f23e, 0x000000000000f14b,
+	0x096f26262e590fe8, 0x0f4fe96cce679850,
+	0x0266ea955ff968bf, 0xaa39ac5110c9ae40,
+	0x02ecbd7c44180c45, 0x000000000000a607,
+	0xc555e0c57a85e7d4, 0x327320ef09cfc80f,
+	0xd4f276daec2d34e5, 0xcb9c11401123926c,
+	0x1185c9eaf84e0ec9, 0x0000000000005fd2,
+	0x7ebc5d644931bfc0, 0xd9676791b4a807c5,
+	0x6681fd1f829eff2c, 0x14ff7a4f11858677,
+	0xe0a2e5989383f0b2, 0x000000000000089e,
+	0x8c7baba41a8b4499, 0xe89903c7abcab1de,
+	0xacac4c6f5cc1de20, 0x2aec33f892112ff3,
+	0x1bee5d883394711e, 0x0000000000002e6b,
+	0x37921605293f1c8d, 0x038d44b916ad7e14,
+	0x1edfc7aa327215e9, 0xf58f58f792b73be8,
+	0xeac971fa58598f65, 0x0000000000007927,
+	0xfba8d0e67de3f4b1, 0x3eb18d3ad1052e4b,
+	0xc84b5be581a649b3, 0x942ae5e6935d07c4,
+	0xf9a0056ce40f8de9, 0x00000000000080f2,
+	0x40416d474e57aca5, 0xd5a5ca446c62e181,
+	0x7a38d020ef15827a, 0x4b498ee993fb13df,
+	0x0887291e8fc27392, 0x000000000000d7be,
+	0x1e273d66da960203, 0x5d4d4596efc0427c,
+	0x5c1039043d180bab, 0xe80c7689947454cd,
+	0x0f39754da4208eb1, 0x000000000000cd19,
+	0xa5ce80c7e9225a17, 0xb65902e852a78db6,
+	0xee63b2c153abc062, 0x376f1d8694d240d6,
+	0xfe1e593fcfed70ca, 0x0000000000009a55,
+	0x69f44624bdfeb22b, 0x8b65cb6b950fdde9,
+	0x38f72e8ee07f9c38, 0x56caa09795387cfa,
+	0xed772da973bb7246, 0x0000000000006380,
+	0xd21dfb858e4aea3f, 0x60718c1528681223,
+	0x8a84a54b8ecc57f1, 0x89a9cb98959e68e1,
+	0x1c5001db18768c3d, 0x00000000000034cc,
+	0x20da0d45ddf01166, 0x518fe843370aa438,
+	0x40a9143b509376fd, 0xb7ba822f160ac165,
+	0xe71cb9cbb8610d91, 0x0000000000001239,
+	0x9b33b0e4ee444972, 0xba9baf3d8a6d6bf2,
+	0xf2da9ffe3e20bd34, 0x68d9e92016acd57e,
+	0x163b95b9d3acf3ea, 0x0000000000004575,
+	0x57097607ba98a14e, 0x87a766be4dc53bad,
+	0x244e03b18df4e16e, 0x097c54311746e952,
+	0x0552e12f6ffaf166, 0x000000000000bca0,
+	0xece0cba6892cf95a, 0x6cb321c0f0a2f467,
+	0x963d8874e3472aa7, 0xd61f3f3e17e0fd49,
+	0xf475cd5d04370f1d, 0x000000000000ebec,
+	0xebc5d644931bfc02, 0x9676791b4a807c57,
+	0x681fd1f829eff2cd, 0x4ff7a4f118586776,
+	0x0a2e5989383f0b21, 0x00000000000089ee,
+	0x502c6be5a0afa416, 0x7d623e65f7e7b39d,
+	0xda6c5a3d475c3904, 0x9094cffe18fe736d,
+	0xfb0975fb53f2f55a, 0x000000000000dea2,
+	0x9c16ad06f4734c2a, 0x405ef7e6304fe3c2,
+	0x0cf8c672f488655e, 0xf13172ef19144f41,
+	0xe860016defa4f7d6, 0x0000000000002777,
+	0x27ff10a7c7c7143e, 0xab4ab0988d282c08,
+	0xbe8b4db79a3bae97, 0x2e5219e019b25b5a,
+	0x19472d1f846909ad, 0x000000000000703b,
+	0xd538e667947def67, 0x9ab4d4ce924a9a13,
+	0x74a6fcc744648f9b, 0x104150579a26f2de,
+	0xe20b950f247e8801, 0x00000000000056ce,
+	0x6ed15bc6a7c9b773, 0x71a093b02f2d55d9,
+	0xc6d577022ad74452, 0xcf223b589a80e6c5,
+	0x132cb97d4fb3767a, 0x0000000000000182,
+	0xa2eb9d25f3155f4f, 0x4c9c5a33e8850586,
+	0x1041eb4d99031808, 0xae8786499b6adae9,
+	0x0045cdebf3e574f6, 0x000000000000f857,
+	0x19022084c0a1075b, 0xa7881d4d55e2ca4c,
+	0xa2326088f7b0d3c1, 0x71e4ed469bcccef2,
+	0xf162e19998288a8d, 0x000000000000af1b,
+	0x476470a55460a9fd, 0x2f60929fd64069b1,
+	0x841a89ac25bd5a10, 0xd2a115269c4389e0,
+	0xf6dcbdcab3ca77ae, 0x000000000000b5bc,
+	0xfc8dcd0467d4f1e9, 0xc474d5e16b27a67b,
+	0x366902694b0e91d9, 0x0dc27e299ce59dfb,
+	0x07fb91b8d80789d5, 0x000000000000e2f0,
+	0x30b70be7330819d5, 0xf9481c62ac8ff624,
+	0xe0fd9e26f8dacd83, 0x6c67c3389d0fa1d7,
+	0x1492e52e64518b59, 0x0000000000001b25,
+	0x8b5eb64600bc41c1, 0x125c5b1c11e839ee,
+	0x528e15e39669064a, 0xb304a8379da9b5cc,
+	0xe5b5c95c0f9c7522, 0x0000000000004c69,
+	0x799940865306ba98, 0x23a23f4a0e8a8ff5,
+	0x98a3a49348362746, 0x8d17e1801e3d1c48,
+	0x1ef9714caf8bf48e, 0x0000000000006a9c,
+	0xc270fd2760b2e28c, 0xc8b67834b3ed403f,
+	0x2ad02f562685ec8f, 0x52748a8f1e9b0853,
+	0xefde5d3ec4460af5, 0x0000000000003dd0,
+	0x0e4a3bc4346e0ab0, 0xf58ab1b774451060,
+	0xfc44b3199551b0d5, 0x33d1379e1f71347f,
+	0xfcb729a878100879, 0x000000000000c405,
+	0xb5a3866507da52a4, 0x1e9ef6c9c922dfaa,
+	0x4e3738dcfbe27b1c, 0xecb25c911fd72064,
+	0x0d9005da13ddf602, 0x0000000000009349,
+	0xb456f1a9f26ddccd, 0x6824ec0bcb55765b,
+	0xb55dc08ab5d1149c, 0xc88ed626a039b171,
+	0xcb2e5f53ecdd9eb3, 0x0000000000006084,
+	0x0fbf4c08c1d984d9, 0x8330ab757632b991,
+	0x072e4b4fdb62df55, 0x17edbd29a09fa56a,
+	0x3a097321871060c8, 0x00000000000037c8,
+	0xc3858aeb95056ce5, 0xbe0c62f6b19ae9ce,
+	0xd1bad70068b6830f, 0x76480038a1759946,
+	0x296007b73b466244, 0x000000000000ce1d,
+	0x786c374aa6b134f1, 0x551825880cfd2604,
+	0x63c95cc5060548c6, 0xa92b6b37a1d38d5d,
+	0xd8472bc5508b9c3f, 0x0000000000009951,
+	0x8aabc18af50bcfa8, 0x64e641de139f901f,
+	0xa9e4edb5d85a69ca, 0x97382280224724d9,
+	0x230b93d5f09c1d93, 0x000000000000bfa4,
+	0x31427c2bc6bf97bc, 0x8ff206a0aef85fd5,
+	0x1b976670b6e9a203, 0x485b498f22e130c2,
+	0xd22cbfa79b51e3e8, 0x000000000000e8e8,
+	0xfd78bac892637f80, 0xb2cecf2369500f8a,
+	0xcd03fa3f053dfe59, 0x29fef49e230b0cee,
+	0xc145cb312707e164, 0x000000000000113d,
+	0x46910769a1d72794, 0x59da885dd437c040,
+	0x7f7071fa6b8e3590, 0xf69d9f9123ad18f5,
+	0x3062e7434cca1f1f, 0x0000000000004671,
+	0x18f7574835168932, 0xd132078f579563bd,
+	0x595898deb983bc41, 0x55d867f124225fe7,
+	0x37dcbb106728e23c, 0x0000000000005cd6,
+	0xa31eeae906a2d126, 0x3a2640f1eaf2ac77,
+	0xeb2b131bd7307788, 0x8abb0cfe24844bfc,
+	0xc6fb97620ce51c47, 0x0000000000000b9a,
+	0x6f242c0a527e391a, 0x071a89722d5afc28,
+	0x3dbf8f5464e42bd2, 0xeb1eb1ef256e77d0,
+	0xd592e3f4b0b31ecb, 0x000000000000f24f,
+	0xd4cd91ab61ca610e, 0xec0ece0c903d33e2,
+	0x8fcc04910a57e01b, 0x347ddae025c863cb,
+	0x24b5cf86db7ee0b0, 0x000000000000a503,
+	0x260a676b32709a57, 0xddf0aa5a8f5f85f9,
+	0x45e1b5e1d408c117, 0x0a6e9357a65cca4f,
+	0xdff977967b69611c, 0x00000000000083f6,
+	0x9de3daca01c4c243, 0x36e4ed2432384a33,
+	0xf7923e24babb0ade, 0xd50df858a6fade54,
+	0x2ede5be410a49f67, 0x000000000000d4ba,
+	0x51d91c2955182a7f, 0x0bd824a7f5901a6c,
+	0x2106a26b096f5684, 0xb4a84549a710e278,
+	0x3db72f72acf29deb, 0x0000000000002d6f,
+	0xea30a18866ac726b, 0xe0cc63d948f7d5a6,
+	0x937529ae67dc9d4d, 0x6bcb2e46a7b6f663,
+	0xcc900300c73f6390, 0x0000000000007a23,
+	0xed15bc6a7c9b7733, 0x1a093b02f2d55d96,
+	0x6d577022ad744527, 0xf223b589a80e6c5c,
+	0x32cb97d4fb3767ac, 0x0000000000001821,
+	0x56fc01cb4f2f2f27, 0xf11d7c7c4fb2925c,
+	0xdf24fbe7c3c78eee, 0x2d40de86a8a87847,
+	0xc3ecbba690fa99d7, 0x0000000000004f6d,
+	0x9ac6c7281bf3c71b, 0xcc21b5ff881ac203,
+	0x09b067a87013d2b4, 0x4ce56397a942446b,
+	0xd085cf302cac9b5b, 0x000000000000b6b8,
+	0x212f7a8928479f0f, 0x2735f281357d0dc9,
+	0xbbc3ec6d1ea0197d, 0x93860898a9e45070,
+	0x21a2e34247616520, 0x000000000000e1f4,
+	0xd3e88c497bfd6456, 0x16cb96d72a1fbbd2,
+	0x71ee5d1dc0ff3871, 0xad95412f2a70f9f4,
+	0xdaee5b52e776e48c, 0x000000000000c701,
+	0x680131e848493c42, 0xfddfd1a997787418,
+	0xc39dd6d8ae4cf3b8, 0x72f62a202ad6edef,
+	0x2bc977208cbb1af7, 0x000000000000904d,
+	0xa43bf70b1c95d47e, 0xc0e3182a50d02447,
+	0x15094a971d98afe2, 0x135397312b3cd1c3,
+	0x38a003b630ed187b, 0x0000000000006998,
+	0x1fd24aaa2f218c6a, 0x2bf75f54edb7eb8d,
+	0xa77ac152732b642b, 0xcc30fc3e2b9ac5d8,
+	0xc9872fc45b20e600, 0x0000000000003ed4,
+	0x41b41a8bbbe022cc, 0xa31fd0866e154870,
+	0x81522876a126edfa, 0x6f75045e2c1582ca,
+	0xce39739770c21b23, 0x0000000000002473,
+	0xfa5da72a88547ad8, 0x480b97f8d37287ba,
+	0x3321a3b3cf952633, 0xb0166f512cb396d1,
+	0x3f1e5fe51b0fe558, 0x000000000000733f,
+	0x366761c9dc8892e4, 0x75375e7b14dad7e5,
+	0xe5b53ffc7c417a69, 0xd1b3d2402d59aafd,
+	0x2c772b73a759e7d4, 0x0000000000008aea,
+	0x8d8edc68ef3ccaf0, 0x9e231905a9bd182f,
+	0x57c6b43912f2b1a0, 0x0ed0b94f2dffbee6,
+	0xdd500701cc9419af, 0x000000000000dda6,
+	0x7f492aa8bc8631a9, 0xafdd7d53b6dfae34,
+	0x9deb0549ccad90ac, 0x30c3f0f8ae6b1762,
+	0x261cbf116c839803, 0x000000000000fb53,
+	0xc4a097098f3269bd, 0x44c93a2d0bb861fe,
+	0x2f988e8ca21e5b65, 0xefa09bf7aecd0379,
+	0xd73b9363074e6678, 0x000000000000ac1f,
+	0x089a51eadbee8181, 0x79f5f3aecc1031a1,
+	0xf90c12c311ca073f, 0x8e0526e6af273f55,
+	0xc452e7f5bb1864f4, 0x00000000000055ca,
+	0xb373ec4be85ad995, 0x92e1b4d07177fe6b,
+	0x4b7f99067f79ccf6, 0x51664de9af812b4e,
+	0x3575cb87d0d59a8f, 0x0000000000000286,
+	0x06d06a2eef808b31, 0x8c7f4219b85521c1,
+	0x0548a1da849bb7ea, 0xbdd41178b0560b2a,
+	0x38e5ce5dc3086c8d, 0x00000000000091cf,
+	0xbd39d78fdc34d325, 0x676b05670532ee0b,
+	0xb73b2a1fea287c23, 0x62b77a77b0f01f31,
+	0xc9c2e22fa8c592f6, 0x000000000000c683,
+	0x7103116c88e83b19, 0x5a57cce4c29abe54,
+	0x61afb65059fc2079, 0x0312c766b11a231d,
+	0xdaab96b91493907a, 0x0000000000003f56,
+	0xcaeaaccdbb5c630d, 0xb1438b9a7ffd719e,
+	0xd3dc3d95374febb0, 0xdc71ac69b1bc3706,
+	0x2b8cbacb7f5e6e01, 0x000000000000681a,
+	0x382d5a0de8e69854, 0x80bdefcc609fc785,
+	0x19f18ce5e910cabc, 0xe262e5de32289e82,
+	0xd0c002dbdf49efad, 0x0000000000004eef,
+	0x83c4e7acdb52c040, 0x6ba9a8b2ddf8084f,
+	0xab82072087a30175, 0x3d018ed1328e8a99,
+	0x21e72ea9b48411d6, 0x00000000000019a3,
+	0x4ffe214f8f8e287c, 0x569561311a505810,
+	0x7d169b6f34775d2f, 0x5ca433c03364b6b5,
+	0x328e5a3f08d2135a, 0x000000000000e076,
+	0xf4179ceebc3a7068, 0xbd81264fa73797da,
+	0xcf6510aa5ac496e6, 0x83c758cf33c2a2ae,
+	0xc3a9764d631fed21, 0x000000000000b73a,
+	0xaa71cccf28fbdece, 0x3569a99d24953427,
+	0xe94df98e88c91f37, 0x2082a0af344de5bc,
+	0xc4172a1e48fd1002, 0x000000000000ad9d,
+	0x1198716e1b4f86da, 0xde7deee399f2fbed,
+	0x5b3e724be67ad4fe, 0xffe1cba034ebf1a7,
+	0x3530066c2330ee79, 0x000000000000fad1,
+	0xdda2b78d4f936ee6, 0xe34127605e5aabb2,
+	0x8daaee0455ae88a4, 0x9e4476b13501cd8b,
+	0x265972fa9f66ecf5, 0x0000000000000304,
+	0x664b0a2c7c2736f2, 0x0855601ee33d6478,
+	0x3fd965c13b1d436d, 0x41271dbe35a7d990,
+	0xd77e5e88f4ab128e, 0x0000000000005448,
+	0x948cfcec2f9dcdab, 0x39ab0448fc5fd263,
+	0xf5f4d4b1e5426261, 0x7f345409b6337014,
+	0x2c32e69854bc9322, 0x00000000000072bd,
+	0x2f65414d1c2995bf, 0xd2bf433641381da9,
+	0x47875f748bf1a9a8, 0xa0573f06b695640f,
+	0xdd15caea3f716d59, 0x00000000000025f1,
+	0xe35f87ae48f57d83, 0xef838ab586904df6,
+	0x9113c33b3825f5f2, 0xc1f28217b77f5823,
+	0xce7cbe7c83276fd5, 0x000000000000dc24,
+	0x58b63a0f7b412597, 0x0497cdcb3bf7823c,
+	0x236048fe56963e3b, 0x1e91e918b7d94c38,
+	0x3f5b920ee8ea91ae, 0x0000000000008b68,
+	0x5f9327ed617620cf, 0xfe52951081d50a0c,
+	0xdd4211729c3ee651, 0x877972d7b861d607,
+	0xc10006dad4e29592, 0x000000000000e96a,
+	0xe47a9a4c52c278db, 0x1546d26e3cb2c5c6,
+	0x6f319ab7f28d2d98, 0x581a19d8b8c7c21c,
+	0x30272aa8bf2f6be9, 0x000000000000be26,
+	0x28405caf061e90e7, 0x287a1bedfb1a9599,
+	0xb9a506f8415971c2, 0x39bfa4c9b92dfe30,
+	0x234e5e3e03796965, 0x00000000000047f3,
+	0x93a9e10e35aac8f3, 0xc36e5c93467d5a53,
+	0x0bd68d3d2feaba0b, 0xe6dccfc6b98bea2b,
+	0xd269724c68b4971e, 0x00000000000010bf,
+	0x616e17ce661033aa, 0xf29038c5591fec48,
+	0xc1fb3c4df1b59b07, 0xd8cf86713a1f43af,
+	0x2925ca5cc8a316b2, 0x000000000000364a,
+	0xda87aa6f55a46bbe, 0x19847fbbe4782382,
+	0x7388b7889f0650ce, 0x07aced7e3ab957b4,
+	0xd802e62ea36ee8c9, 0x0000000000006106,
+	0x16bd6c8c01788382, 0x24b8b63823d073dd,
+	0xa51c2bc72cd20c94, 0x6609506f3b536b98,
+	0xcb6b92b81f38ea45, 0x00000000000098d3,
+	0xad54d12d32ccdb96, 0xcfacf1469eb7bc17,
+	0x176fa0024261c75d, 0xb96a3b603bf57f83,
+	0x3a4cbeca74f5143e, 0x000000000000cf9f,
+	0xf332810ca60d7530, 0x47447e941d151fea,
+	0x31474926906c4e8c, 0x1a2fc3003c7a3891,
+	0x3df2e2995f17e91d, 0x000000000000d538,
+	0x48db3cad95b92d24, 0xac5039eaa072d020,
+	0x8334c2e3fedf8545, 0xc54ca80f3cdc2c8a,
+	0xccd5ceeb34da1766, 0x0000000000008274,
+	0x84e1fa4ec165c518, 0x916cf06967da807f,
+	0x55a05eac4d0bd91f, 0xa4e9151e3d3610a6,
+	0xdfbcba7d888c15ea, 0x0000000000007ba1,
+	0x3f0847eff2d19d0c, 0x7a78b717dabd4fb5,
+	0xe7d3d56923b812d6, 0x7b8a7e113d9004bd,
+	0x2e9b960fe341eb91, 0x0000000000002ced,
+	0xcdcfb12fa16b6655, 0x4b86d341c5dff9ae,
+	0x2dfe6419fde733da, 0x459937a6be04ad39,
+	0xd5d72e1f43566a3d, 0x0000000000000a18,
+	0x76260c8e92df3e41, 0xa092943f78b83664,
+	0x9f8defdc9354f813, 0x9afa5ca9bea2b922,
+	0x24f0026d289b9446, 0x0000000000005d54,
+	0xba1cca6dc603d67d, 0x9dae5dbcbf10663b,
+	0x491973932080a449, 0xfb5fe1b8bf48850e,
+	0x379976fb94cd96ca, 0x000000000000a481,
+	0x01f577ccf5b78e69, 0x76ba1ac20277a9f1,
+	0xfb6af8564e336f80, 0x243c8ab7bfee9115,
+	0xc6be5a89ff0068b1, 0x000000000000f3cd,
+	0x68ade353e4dbb99a, 0xd049d81796aaecb7,
+	0x6abb81156ba22938, 0x911dac4d407362e3,
+	0x965cbea7d9bb3d67, 0x000000000000c109,
+	0xd3445ef2d76fe18e, 0x3b5d9f692bcd237d,
+	0xd8c80ad00511e2f1, 0x4e7ec74240d576f8,
+	0x677b92d5b276c31c, 0x0000000000009645,
+	0x1f7e981183b309b2, 0x066156eaec657322,
+	0x0e5c969fb6c5beab, 0x2fdb7a53413f4ad4,
+	0x7412e6430e20c190, 0x0000000000006f90,
+	0xa49725b0b00751a6, 0xed7511945102bce8,
+	0xbc2f1d5ad8767562, 0xf0b8115c41995ecf,
+	0x8535ca3165ed3feb, 0x00000000000038dc,
+	0x5650d370e3bdaaff, 0xdc8b75c24e600af3,
+	0x7602ac2a0629546e, 0xceab58ebc20df74b,
+	0x7e797221c5fabe47, 0x0000000000001e29,
+	0xedb96ed1d009f2eb, 0x379f32bcf307c539,
+	0xc47127ef689a9fa7, 0x11c833e4c2abe350,
+	0x8f5e5e53ae37403c, 0x0000000000004965,
+	0x2183a83284d51ad7, 0x0aa3fb3f34af9566,
+	0x12e5bba0db4ec3fd, 0x706d8ef5c341df7c,
+	0x9c372ac5126142b0, 0x000000000000b0b0,
+	0x9a6a1593b76142c3, 0xe1b7bc4189c85aac,
+	0xa0963065b5fd0834, 0xaf0ee5fac3e7cb67,
+	0x6d1006b779acbccb, 0x000000000000e7fc,
+	0xc40c45b223a0ec65, 0x695f33930a6af951,
+	0x86bed94167f081e5, 0x0c4b1d9ac4688c75,
+	0x6aae5ae4524e41e8, 0x000000000000fd5b,
+	0x7fe5f8131014b471, 0x824b74edb70d369b,
+	0x34cd528409434a2c, 0xd3287695c4ce986e,
+	0x9b8976963983bf93, 0x000000000000aa17,
+	0xb3df3ef044c85c4d, 0xbf77bd6e70a566c4,
+	0xe259cecbba971676, 0xb28dcb84c524a442,
+	0x88e0020085d5bd1f, 0x00000000000053c2,
+	0x08368351777c0459, 0x5463fa10cdc2a90e,
+	0x502a450ed424ddbf, 0x6deea08bc582b059,
+	0x79c72e72ee184364, 0x000000000000048e,
+	0xfaf1759124c6ff00, 0x659d9e46d2a01f15,
+	0x9a07f47e0a7bfcb3, 0x53fde93c461619dd,
+	0x828b96624e0fc2c8, 0x000000000000227b,
+	0x4118c8301772a714, 0x8e89d9386fc7d0df,
+	0x28747fbb64c8377a, 0x8c9e823346b00dc6,
+	0x73acba1025c23cb3, 0x0000000000007537,
+	0x8d220ed343ae4f28, 0xb3b510bba86f8080,
+	0xfee0e3f4d71c6b20, 0xed3b3f22475a31ea,
+	0x60c5ce8699943e3f, 0x0000000000008ce2,
+	0x36cbb372701a173c, 0x58a157c515084f4a,
+	0x4c936831b9afa0e9, 0x3258542d47fc25f1,
+	0x91e2e2f4f259c044, 0x000000000000dbae,
+	0x31eeae906a2d1264, 0xa2640f1eaf2ac77a,
+	0xb2b131bd73077883, 0xabb0cfe24844bfce,
+	0x6fb97620ce51c478, 0x000000000000b9ac,
+	0x8a07133159994a70, 0x49704860124d08b0,
+	0x00c2ba781db4b34a, 0x74d3a4ed48e2abd5,
+	0x9e9e5a52a59c3a03, 0x000000000000eee0,
+	0x463dd5d20d45a24c, 0x744c81e3d5e558ef,
+	0xd6562637ae60ef10, 0x157619fc490897f9,
+	0x8df72ec419ca388f, 0x0000000000001735,
+	0xfdd468733ef1fa58, 0x9f58c69d68829725,
+	0x6425adf2c0d324d9, 0xca1572f349ae83e2,
+	0x7cd002b67207c6f4, 0x0000000000004079,
+	0x0f139eb36d4b0101, 0xaea6a2cb77e0213e,
+	0xae081c821e8c05d5, 0xf4063b44ca3a2a66,
+	0x879cbaa6d2104758, 0x000000000000668c,
+	0xb4fa23125eff5915, 0x45b2e5b5ca87eef4,
+	0x1c7b9747703fce1c, 0x2b65504bca9c3e7d,
+	0x76bb96d4b9ddb923, 0x00000000000031c0,
+	0x78c0e5f10a23b129, 0x788e2c360d2fbeab,
+	0xcaef0b08c3eb9246, 0x4ac0ed5acb760251,
+	0x65d2e242058bbbaf, 0x000000000000c815,
+	0xc32958503997e93d, 0x939a6b48b0487161,
+	0x789c80cdad58598f, 0x95a38655cbd0164a,
+	0x94f5ce306e4645d4, 0x0000000000009f59,
+	0x9d4f0871ad56479b, 0x1b72e49a33ead29c,
+	0x5eb469e97f55d05e, 0x36e67e35cc5f5158,
+	0x934b926345a4b8f7, 0x00000000000085fe,
+	0x26a6b5d09ee21f8f, 0xf066a3e48e8d1d56,
+	0xecc7e22c11e61b97, 0xe985153accf94543,
+	0x626cbe112e69468c, 0x000000000000d2b2,
+	0xea9c7333ca3ef7b3, 0xcd5a6a6749254d09,
+	0x3a537e63a23247cd, 0x8820a82bcd13796f,
+	0x7105ca87923f4400, 0x0000000000002b67,
+	0x5175ce92f98aafa7, 0x264e2d19f44282c3,
+	0x8820f5a6cc818c04, 0x5743c324cdb56d74,
+	0x8022e6f5f9f2ba7b, 0x0000000000007c2b,
+	0xa3b23852aa3054fe, 0x17b0494feb2034d8,
+	0x420d44d612dead08, 0x69508a934e21c4f0,
+	0x7b6e5ee559e53bd7, 0x0000000000005ade,
+	0x185b85f399840cea, 0xfca40e315647fb12,
+	0xf07ecf137c6d66c1, 0xb633e19c4e87d0eb,
+	0x8a4972973228c5ac, 0x0000000000000d92,
+	0xd4614310cd58e4d6, 0xc198c7b291efab4d,
+	0x26ea535ccfb93a9b, 0xd7965c8d4f6decc7,
+	0x992006018e7ec720, 0x000000000000f447,
+	0x6f88feb1feecbcc2, 0x2a8c80cc2c886487,
+	0x9499d899a10af152, 0x08f537824fcbf8dc,
+	0x68072a73e5b3395b, 0x000000000000a30b,
+	0xda2b78d4f936ee66, 0x34127605e5aabb2d,
+	0xdaaee0455ae88a4e, 0xe4476b13501cd8b8,
+	0x65972fa9f66ecf59, 0x0000000000003042,
+	0x61c2c575ca82b672, 0xdf06317b58cd74e7,
+	0x68dd6b80345b4187, 0x3b24001c50bacca3,
+	0x94b003db9da33122, 0x000000000000670e,
+	0xadf803969e5e5e4e, 0xe23af8f89f6524b8,
+	0xbe49f7cf878f1ddd, 0x5a81bd0d5150f08f,
+	0x87d9774d21f533ae, 0x0000000000009edb,
+	0x1611be37adea065a, 0x092ebf862202eb72,
+	0x0c3a7c0ae93cd614, 0x85e2d60251f6e494,
+	0x76fe5b3f4a38cdd5, 0x000000000000c997,
+	0xe4d648f7fe50fd03, 0x38d0dbd03d605d69,
+	0xc617cd7a3763f718, 0xbbf19fb5d2624d10,
+	0x8db2e32fea2f4c79, 0x000000000000ef62,
+	0x5f3ff556cde4a517, 0xd3c49cae800792a3,
+	0x746446bf59d03cd1, 0x6492f4bad2c4590b,
+	0x7c95cf5d81e2b202, 0x000000000000b82e,
+	0x930533b599384d2b, 0xeef8552d47afc2fc,
+	0xa2f0daf0ea04608b, 0x053749abd32e6527,
+	0x6ffcbbcb3db4b08e, 0x00000000000041fb,
+	0x28ec8e14aa8c153f, 0x05ec1253fac80d36,
+	0x1083513584b7ab42, 0xda5422a4d388713c,
+	0x9edb97b956794ef5, 0x00000000000016b7,
+	0x768ade353e4dbb99, 0x8d049d81796aaecb,
+	0x36abb81156ba2293, 0x7911dac4d407362e,
+	0x9965cbea7d9bb3d6, 0x0000000000000c10,
+	0xcd6363940df9e38d, 0x6610daffc40d6101,
+	0x84d833d43809e95a, 0xa672b1cbd4a12235,
+	0x6842e79816564dad, 0x0000000000005b5c,
+	0x0159a57759250bb1, 0x5b2c137c03a5315e,
+	0x524caf9b8bddb500, 0xc7d70cdad54b1e19,
+	0x7b2b930eaa004f21, 0x000000000000a289,
+	0xbab018d66a9153a5, 0xb0385402bec2fe94,
+	0xe03f245ee56e7ec9, 0x18b467d5d5ed0a02,
+	0x8a0cbf7cc1cdb15a, 0x000000000000f5c5,
+	0x4877ee16392ba8fc, 0x81c63054a1a0488f,
+	0x2a12952e3b315fc5, 0x26a72e625679a386,
+	0x7140076c61da30f6, 0x000000000000d330,
+	0xf39e53b70a9ff0e8, 0x6ad2772a1cc78745,
+	0x98611eeb5582940c, 0xf9c4456d56dfb79d,
+	0x80672b1e0a17ce8d, 0x000000000000847c,
+	0x3fa495545e4318d4, 0x57eebea9db6fd71a,
+	0x4ef582a4e656c856, 0x9861f87c57358bb1,
+	0x930e5f88b641cc01, 0x0000000000007da9,
+	0x844d28f56df740c0, 0xbcfaf9d7660818d0,
+	0xfc86096188e5039f, 0x4702937357939faa,
+	0x622973fadd8c327a, 0x0000000000002ae5,
+	0x8368351777c04598, 0x463fa10cdc2a90e0,
+	0x02a450ed424ddbf5, 0xdeea08bc582b0595,
+	0x9c72e72ee1843646, 0x00000000000048e7,
+	0x388188b644741d8c, 0xad2be672614d5f2a,
+	0xb0d7db282cfe103c, 0x018963b3588d118e,
+	0x6d55cb5c8a49c83d, 0x0000000000001fab,
+	0xf4bb4e5510a8f5b0, 0x90172ff1a6e50f75,
+	0x664347679f2a4c66, 0x602cdea259672da2,
+	0x7e3cbfca361fcab1, 0x000000000000e67e,
+	0x4f52f3f4231cada4, 0x7b03688f1b82c0bf,
+	0xd430cca2f19987af, 0xbf4fb5ad59c139b9,
+	0x8f1b93b85dd234ca, 0x000000000000b132,
+	0xbd95053470a656fd, 0x4afd0cd904e076a4,
+	0x1e1d7dd22fc6a6a3, 0x815cfc1ada55903d,
+	0x74572ba8fdc5b566, 0x00000000000097c7,
+	0x067cb89543120ee9, 0xa1e94ba7b987b96e,
+	0xac6ef61741756d6a, 0x5e3f9715daf38426,
+	0x857007da96084b1d, 0x000000000000c08b,
+	0xca467e7617cee6d5, 0x9cd582247e2fe931,
+	0x7afa6a58f2a13130, 0x3f9a2a04db19b80a,
+	0x9619734c2a5e4991, 0x000000000000395e,
+	0x71afc3d7247abec1, 0x77c1c55ac34826fb,
+	0xc889e19d9c12faf9, 0xe0f9410bdbbfac11,
+	0x673e5f3e4193b7ea, 0x0000000000006e12,
+	0x2fc993f6b0bb1067, 0xff294a8840ea8506,
+	0xeea108b94e1f7328, 0x43bcb96bdc30eb03,
+	0x6080036d6a714ac9, 0x00000000000074b5,
+	0x94202e57830f4873, 0x143d0df6fd8d4acc,
+	0x5cd2837c20acb8e1, 0x9cdfd264dc96ff18,
+	0x91a72f1f01bcb4b2, 0x00000000000023f9,
+	0x581ae8b4d7d3a04f, 0x2901c4753a251a93,
+	0x8a461f339378e4bb, 0xfd7a6f75dd7cc334,
+	0x82ce5b89bdeab63e, 0x000000000000da2c,
+	0xe3f35515e467f85b, 0xc215830b8742d559,
+	0x383594f6fdcb2f72, 0x2219047adddad72f,
+	0x73e977fbd6274845, 0x0000000000008d60,
+	0x1134a3d5b7dd0302, 0xf3ebe75d98206342,
+	0xf218258623940e7e, 0x1c0a4dcd5e4e7eab,
+	0x88a5cfeb7630c9e9, 0x000000000000ab95,
+	0xaadd1e7484695b16, 0x18ffa0232547ac88,
+	0x406bae434d27c5b7, 0xc36926c25ee86ab0,
+	0x7982e3991dfd3792, 0x000000000000fcd9,
+	0x66e7d897d0b5b32a, 0x25c369a0e2effcd7,
+	0x96ff320cfef399ed, 0xa2cc9bd35f02569c,
+	0x6aeb970fa1ab351e, 0x000000000000050c,
+	0xdd0e6536e301eb3e, 0xced72ede5f88331d,
+	0x248cb9c990405224, 0x7daff0dc5fa44287,
+	0x9bccbb7dca66cb65, 0x0000000000005240,
+	0xdcfb12fa16b66557, 0xb86d341c5dff9aec,
+	0xdfe6419fde733da4, 0x59937a6be04ad392,
+	0x5d72e1f43566a3d4, 0x000000000000a18d,
+	0x6712af5b25023d43, 0x53797362e0985526,
+	0x6d95ca5ab0c0f66d, 0x86f01164e0ecc789,
+	0xac55cd865eab5daf, 0x000000000000f6c1,
+	0xab2869b871ded57f, 0x6e45bae127300579,
+	0xbb0156150314aa37, 0xe755ac75e106fba5,
+	0xbf3cb910e2fd5f23, 0x0000000000000f14,
+	0x10c1d419426a8d6b, 0x8551fd9f9a57cab3,
+	0x0972ddd06da761fe, 0x3836c77ae1a0efbe,
+	0x4e1b95628930a158, 0x0000000000005858,
+	0xe20622d911d07632, 0xb4af99c985357ca8,
+	0xc35f6ca0b3f840f2, 0x06258ecd6234463a,
+	0xb5572d72292720f4, 0x0000000000007ead,
+	0x59ef9f7822642e26, 0x5fbbdeb73852b362,
+	0x712ce765dd4b8b3b, 0xd946e5c262925221,
+	0x4470010042eade8f, 0x00000000000029e1,
+	0x95d5599b76b8c61a, 0x62871734fffae33d,
+	0xa7b87b2a6e9fd761, 0xb8e358d363786e0d,
+	0x57197596febcdc03, 0x000000000000d034,
+	0x2e3ce43a450c9e0e, 0x8993504a429d2cf7,
+	0x15cbf0ef002c1ca8, 0x678033dc63de7a16,
+	0xa63e59e495712278, 0x0000000000008778,
+	0x705ab41bd1cd30a8, 0x017bdf98c13f8f0a,
+	0x33e319cbd2219579, 0xc4c5cbbc64513d04,
+	0xa18005b7be93df5b, 0x0000000000009ddf,
+	0xcbb309bae27968bc, 0xea6f98e67c5840c0,
+	0x8190920ebc925eb0, 0x1ba6a0b364f7291f,
+	0x50a729c5d55e2120, 0x000000000000ca93,
+	0x0789cf59b6a58080, 0xd7535165bbf0109f,
+	0x57040e410f4602ea, 0x7a031da2651d1533,
+	0x43ce5d53690823ac, 0x0000000000003346,
+	0xbc6072f88511d894, 0x3c47161b0697df55,
+	0xe577858461f5c923, 0xa56076ad65bb0128,
+	0xb2e9712102c5ddd7, 0x000000000000640a,
+	0x4ea78438d6ab23cd, 0x0db9724d19f5694e,
+	0x2f5a34f4bfaae82f, 0x9b733f1ae62fa8ac,
+	0x49a5c931a2d25c7b, 0x00000000000042ff,
+	0xf54e3999e51f7bd9, 0xe6ad3533a492a684,
+	0x9d29bf31d11923e6, 0x44105415e689bcb7,
+	0xb882e543c91fa200, 0x00000000000015b3,
+	0x3974ff7ab1c393e5, 0xdb91fcb0633af6db,
+	0x4bbd237e62cd7fbc, 0x25b5e904e763809b,
+	0xabeb91d57549a08c, 0x000000000000ec66,
+	0x829d42db8277cbf1, 0x3085bbcede5d3911,
+	0xf9cea8bb0c7eb475, 0xfad6820be7c59480,
+	0x5accbda71e845ef7, 0x000000000000bb2a,
+	0x85b85f399840cea9, 0xca40e315647fb121,
+	0x07ecf137c6d66c1f, 0x633e19c4e87d0ebf,
+	0xa4972973228c5acb, 0x000000000000d928,
+	0x3e51e298abf496bd, 0x2154a46bd9187eeb,
+	0xb59f7af2a865a7d6, 0xbc5d72cbe8db1aa4,
+	0x55b005014941a4b0, 0x0000000000008e64,
+	0xf26b247bff287e81, 0x1c686de81eb02eb4,
+	0x630be6bd1bb1fb8c, 0xddf8cfdae9312688,
+	0x46d97197f517a63c, 0x00000000000077b1,
+	0x498299dacc9c2695, 0xf77c2a96a3d7e17e,
+	0xd1786d7875023045, 0x029ba4d5e9973293,
+	0xb7fe5de59eda5847, 0x00000000000020fd,
+	0xbb456f1a9f26ddcc, 0xc6824ec0bcb55765,
+	0x1b55dc08ab5d1149, 0x3c88ed626a039b17,
+	0x4cb2e5f53ecdd9eb, 0x0000000000000608,
+	0x00acd2bbac9285d8, 0x2d9609be01d298af,
+	0xa92657cdc5eeda80, 0xe3eb866d6aa58f0c,
+	0xbd95c98755002790, 0x0000000000005144,
+	0xcc961458f84e6de4, 0x10aac03dc67ac8f0,
+	0x7fb2cb82763a86da, 0x824e3b7c6b4fb320,
+	0xaefcbd11e956251c, 0x000000000000a891,
+	0x777fa9f9cbfa35f0, 0xfbbe87437b1d073a,
+	0xcdc1404718894d13, 0x5d2d50736be9a73b,
+	0x5fdb9163829bdb67, 0x000000000000ffdd,
+	0x2919f9d85f3b9b56, 0x73560891f8bfa4c7,
+	0xebe9a963ca84c4c2, 0xfe68a8136c66e029,
+	0x5865cd30a9792644, 0x000000000000e57a,
+	0x92f044796c8fc342, 0x98424fef45d86b0d,
+	0x599a22a6a4370f0b, 0x210bc31c6cc0f432,
+	0xa942e142c2b4d83f, 0x000000000000b236,
+	0x5eca829a38532b7e, 0xa57e866c82703b52,
+	0x8f0ebee917e35351, 0x40ae7e0d6d2ac81e,
+	0xba2b95d47ee2dab3, 0x0000000000004be3,
+	0xe5233f3b0be7736a, 0x4e6ac1123f17f498,
+	0x3d7d352c79509898, 0x9fcd15026d8cdc05,
+	0x4b0cb9a6152f24c8, 0x0000000000001caf,
+	0x17e4c9fb585d8833, 0x7f94a54420754283,
+	0xf750845ca70fb994, 0xa1de5cb5ee187581,
+	0xb04001b6b538a564, 0x0000000000003a5a,
+	0xac0d745a6be9d027, 0x9480e23a9d128d49,
+	0x45230f99c9bc725d, 0x7ebd37baeebe619a,
+	0x41672dc4def55b1f, 0x0000000000006d16,
+	0x6037b2b93f35381b, 0xa9bc2bb95abadd16,
+	0x93b793d67a682e07, 0x1f188aabef545db6,
+	0x520e595262a35993, 0x00000000000094c3,
+	0xdbde0f180c81600f, 0x42a86cc7e7dd12dc,
+	0x21c4181314dbe5ce, 0xc07be1a4eff249ad,
+	0xa3297520096ea7e8, 0x000000000000c38f,
+	0x6e7d897d0b5b32ab, 0x5c369a0e2effcd76,
+	0x6ff320cfef399ed2, 0x2cc9bd35f02569c9,
+	0xaeb970fa1ab351ea, 0x00000000000050c6,
+	0xd59434dc38ef6abf, 0xb722dd70939802bc,
+	0xdd80ab0a818a551b, 0xf3aad63af0837dd2,
+	0x5f9e5c88717eaf91, 0x000000000000078a,
+	0x19aef23f6c338283, 0x8a1e14f3543052e3,
+	0x0b143745325e0941, 0x920f6b2bf16941fe,
+	0x4cf7281ecd28ad1d, 0x000000000000fe5f,
+	0xa2474f9e5f87da97, 0x610a538de9579d29,
+	0xb967bc805cedc288, 0x4d6c0024f1cf55e5,
+	0xbdd0046ca6e55366, 0x000000000000a913,
+	0x5080b95e0c3d21ce, 0x50f437dbf6352b32,
+	0x734a0df082b2e384, 0x737f4993725bfc61,
+	0x469cbc7c06f2d2ca, 0x0000000000008fe6,
+	0xeb6904ff3f8979da, 0xbbe070a54b52e4f8,
+	0xc1398635ec01284d, 0xac1c229c72fde87a,
+	0xb7bb900e6d3f2cb1, 0x000000000000d8aa,
+	0x2753c21c6b5591e6, 0x86dcb9268cfab4a7,
+	0x17ad1a7a5fd57417, 0xcdb99f8d7317d456,
+	0xa4d2e498d1692e3d, 0x000000000000217f,
+	0x9cba7fbd58e1c9f2, 0x6dc8fe58319d7b6d,
+	0xa5de91bf3166bfde, 0x12daf48273b1c04d,
+	0x55f5c8eabaa4d046, 0x0000000000007633,
+	0xc2dc2f9ccc206754, 0xe520718ab23fd890,
+	0x83f6789be36b360f, 0xb19f0ce2743e875f,
+	0x524b94b991462d65, 0x0000000000006c94,
+	0x7935923dff943f40, 0x0e3436f40f58175a,
+	0x3185f35e8dd8fdc6, 0x6efc67ed74989344,
+	0xa36cb8cbfa8bd31e, 0x0000000000003bd8,
+	0xb50f54deab48d77c, 0x3308ff77c8f04705,
+	0xe7116f113e0ca19c, 0x0f59dafc7572af68,
+	0xb005cc5d46ddd192, 0x000000000000c20d,
+	0x0ee6e97f98fc8f68, 0xd81cb809759788cf,
+	0x5562e4d450bf6a55, 0xd03ab1f375d4bb73,
+	0x4122e02f2d102fe9, 0x0000000000009541,
+	0xfc211fbfcb467431, 0xe9e2dc5f6af53ed4,
+	0x9f4f55a48ee04b59, 0xee29f844f64012f7,
+	0xba6e583f8d07ae45, 0x000000000000b3b4,
+	0x47c8a21ef8f22c25, 0x02f69b21d792f11e,
+	0x2d3cde61e0538090, 0x314a934bf6e606ec,
+	0x4b49744de6ca503e, 0x000000000000e4f8,
+	0x8bf264fdac2ec419, 0x3fca52a2103aa141,
+	0xfba8422e5387dcca, 0x50ef2e5af70c3ac0,
+	0x582000db5a9c52b2, 0x0000000000001d2d,
+	0x301bd95c9f9a9c0d, 0xd4de15dcad5d6e8b,
+	0x49dbc9eb3d341703, 0x8f8c4555f7aa2edb,
+	0xa9072ca93151acc9, 0x0000000000004a61,
+	0x373ec4be85ad9955, 0x2e1b4d07177fe6bb,
+	0xb7f99067f79ccf69, 0x1664de9af812b4e4,
+	0x575cb87d0d59a8f5, 0x0000000000002863,
+	0x8cd7791fb619c141, 0xc50f0a79aa182971,
+	0x058a1ba2992f04a0, 0xc907b595f8b4a0ff,
+	0xa67b940f6694568e, 0x0000000000007f2f,
+	0x40edbffce2c5297d, 0xf833c3fa6db0792e,
+	0xd31e87ed2afb58fa, 0xa8a20884f95e9cd3,
+	0xb512e099dac25402, 0x00000000000086fa,
+	0xfb04025dd1717169, 0x13278484d0d7b6e4,
+	0x616d0c2844489333, 0x77c1638bf9f888c8,
+	0x4435ccebb10faa79, 0x000000000000d1b6,
+	0x09c3f49d82cb8a30, 0x22d9e0d2cfb500ff,
+	0xab40bd589a17b23f, 0x49d22a3c7a6c214c,
+	0xbf7974fb11182bd5, 0x000000000000f743,
+	0xb22a493cb17fd224, 0xc9cda7ac72d2cf35,
+	0x1933369df4a479f6, 0x96b141337aca3557,
+	0x4e5e58897ad5d5ae, 0x000000000000a00f,
+	0x7e108fdfe5a33a18, 0xf4f16e2fb57a9f6a,
+	0xcfa7aad2477025ac, 0xf714fc227b20097b,
+	0x5d372c1fc683d722, 0x00000000000059da,
+	0xc5f9327ed617620c, 0x1fe52951081d50a0,
+	0x7dd4211729c3ee65, 0x2877972d7b861d60,
+	0xac10006dad4e2959, 0x0000000000000e96,
+	0x9b9f625f42d6ccaa, 0x970da6838bbff35d,
+	0x5bfcc833fbce67b4, 0x8b326f4d7c095a72,
+	0xabae5c3e86acd47a, 0x0000000000001431,
+	0x2076dffe716294be, 0x7c19e1fd36d83c97,
+	0xe98f43f6957dac7d, 0x545104427caf4e69,
+	0x5a89704ced612a01, 0x000000000000437d,
+	0xec4c191d25be7c82, 0x4125287ef1706cc8,
+	0x3f1bdfb926a9f027, 0x35f4b9537d457245,
+	0x49e004da5137288d, 0x000000000000baa8,
+	0x57a5a4bc160a2496, 0xaa316f004c17a302,
+	0x8d68547c481a3bee, 0xea97d25c7de3665e,
+	0xb8c728a83afad6f6, 0x000000000000ede4,
+	0xa562527c45b0dfcf, 0x9bcf0b5653751519,
+	0x4745e50c96451ae2, 0xd4849bebfe77cfda,
+	0x438b90b89aed575a, 0x000000000000cb11,
+	0x1e8befdd760487db, 0x70db4c28ee12dad3,
+	0xf5366ec9f8f6d12b, 0x0be7f0e4fed1dbc1,
+	0xb2acbccaf120a921, 0x0000000000009c5d,
+	0xd2b1293e22d86fe7, 0x4de785ab29ba8a8c,
+	0x23a2f2864b228d71, 0x6a424df5ff3be7ed,
+	0xa1c5c85c4d76abad, 0x0000000000006588,
+	0x6958949f116c37f3, 0xa6f3c2d594dd4546,
+	0x91d17943259146b8, 0xb52126faff9df3f6,
+	0x50e2e42e26bb55d6, 0x00000000000032c4,
+};
+#endif
+
+const struct bch_def bch_24bit = {
+	.syns		= 48,
+	.generator	= { 0xd15bc6a7c9b77335, 0xa093b02f2d55d96e,
+			    0xd577022ad7445271, 0x223b589a80e6c5c6,
+			    0x2cb97d4fb3767acf, 0x18213 },
+	.degree		= 336,
+	.ecc_bytes	= 42,
+	.field		= &gf14,
+	.table		= BCH_TABLE(bch_24bit_table)
+};
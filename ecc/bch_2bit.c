@@ -0,0 +1,297 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include "bch.h"
+
+/* 2-bit ECC over GF(2^13). Each code has its own file, so that only
+ * the tables for codes in use are linked.
+ */
+
+#ifndef BCH_NO_TABLES
+/* Slice-by-4 remainder table, generated with tools/gentab from the
+ * generator polynomial (shifted right by one bit). The degree is under
+ * 32, so 32-bit entries suffice.
+ */
+static const uint32_t bch_2bit_table[BCH_TABLE_SIZE] = {
+	0x00000000, 0x030cb5c9, 0x02cc7ed9, 0x01c0cb10,
+	0x014de8f9, 0x02415d30, 0x03819620, 0x008d23e9,
+	0x029bd1f2, 0x0197643b, 0x0057af2b, 0x035b1ae2,
+	0x03d6390b, 0x00da8cc2, 0x011a47d2, 0x0216f21b,
+	0x01e2b6af, 0x02ee0366, 0x032ec876, 0x00227dbf,
+	0x00af5e56, 0x03a3eb9f, 0x0263208f, 0x016f9546,
+	0x0379675d, 0x0075d294, 0x01b51984, 0x02b9ac4d,
+	0x02348fa4, 0x01383a6d, 0x00f8f17d, 0x03f444b4,
+	0x03c56d5e, 0x00c9d897, 0x01091387, 0x0205a64e,
+	0x028885a7, 0x0184306e, 0x0044fb7e, 0x03484eb7,
+	0x015ebcac, 0x02520965, 0x0392c275, 0x009e77bc,
+	0x00135455, 0x031fe19c, 0x02df2a8c, 0x01d39f45,
+	0x0227dbf1, 0x012b6e38, 0x00eba528, 0x03e710e1,
+	0x036a3308, 0x006686c1, 0x01a64dd1, 0x02aaf818,
+	0x00bc0a03, 0x03b0bfca, 0x027074da, 0x017cc113,
+	0x01f1e2fa, 0x02fd5733, 0x033d9c23, 0x003129ea,
+	0x035fcff7, 0x00537a3e, 0x0193b12e, 0x029f04e7,
+	0x0212270e, 0x011e92c7, 0x00de59d7, 0x03d2ec1e,
+	0x01c41e05, 0x02c8abcc, 0x030860dc, 0x0004d515,
+	0x0089f6fc, 0x03854335, 0x02458825, 0x01493dec,
+	0x02bd7958, 0x01b1cc91, 0x00710781, 0x037db248,
+	0x03f091a1, 0x00fc2468, 0x013cef78, 0x02305ab1,
+	0x0026a8aa, 0x032a1d63, 0x02ead673, 0x01e663ba,
+	0x016b4053, 0x0267f59a, 0x03a73e8a, 0x00ab8b43,
+	0x009aa2a9, 0x03961760, 0x0256dc70, 0x015a69b9,
+	0x01d74a50, 0x02dbff99, 0x031b3489, 0x00178140,
+	0x0201735b, 0x010dc692, 0x00cd0d82, 0x03c1b84b,
+	0x034c9ba2, 0x00402e6b, 0x0180e57b, 0x028c50b2,
+	0x01781406, 0x0274a1cf, 0x03b46adf, 0x00b8df16,
+	0x0035fcff, 0x03394936, 0x02f98226, 0x01f537ef,
+	0x03e3c5f4, 0x00ef703d, 0x012fbb2d, 0x02230ee4,
+	0x02ae2d0d, 0x01a298c4, 0x006253d4, 0x036ee61d,
+	0x026a8aa5, 0x01663f6c, 0x00a6f47c, 0x03aa41b5,
+	0x0327625c, 0x002bd795, 0x01eb1c85, 0x02e7a94c,
+	0x00f15b57, 0x03fdee9e, 0x023d258e, 0x01319047,
+	0x01bcb3ae, 0x02b00667, 0x0370cd77, 0x007c78be,
+	0x03883c0a, 0x008489c3, 0x014442d3, 0x0248f71a,
+	0x02c5d4f3, 0x01c9613a, 0x0009aa2a, 0x03051fe3,
+	0x0113edf8, 0x021f5831, 0x03df9321, 0x00d326e8,
+	0x005e0501, 0x0352b0c8, 0x02927bd8, 0x019ece11,
+	0x01afe7fb, 0x02a35232, 0x03639922, 0x006f2ceb,
+	0x00e20f02, 0x03eebacb, 0x022e71db, 0x0122c412,
+	0x03343609, 0x003883c0, 0x01f848d0, 0x02f4fd19,
+	0x0279def0, 0x01756b39, 0x00b5a029, 0x03b915e0,
+	0x004d5154, 0x0341e49d, 0x02812f8d, 0x018d9a44,
+	0x0100b9ad, 0x020c0c64, 0x03ccc774, 0x00c072bd,
+	0x02d680a6, 0x01da356f, 0x001afe7f, 0x03164bb6,
+	0x039b685f, 0x0097dd96, 0x01571686, 0x025ba34f,
+	0x01354552, 0x0239f09b, 0x03f93b8b, 0x00f58e42,
+	0x0078adab, 0x03741862, 0x02b4d372, 0x01b866bb,
+	0x03ae94a0, 0x00a22169, 0x0162ea79, 0x026e5fb0,
+	0x02e37c59, 0x01efc990, 0x002f0280, 0x0323b749,
+	0x00d7f3fd, 0x03db4634, 0x021b8d24, 0x011738ed,
+	0x019a1b04, 0x0296aecd, 0x035665dd, 0x005ad014,
+	0x024c220f, 0x014097c6, 0x00805cd6, 0x038ce91f,
+	0x0301caf6, 0x000d7f3f, 0x01cdb42f, 0x02c101e6,
+	0x02f0280c, 0x01fc9dc5, 0x003c56d5, 0x0330e31c,
+	0x03bdc0f5, 0x00b1753c, 0x0171be2c, 0x027d0be5,
+	0x006bf9fe, 0x03674c37, 0x02a78727, 0x01ab32ee,
+	0x01261107, 0x022aa4ce, 0x03ea6fde, 0x00e6da17,
+	0x03129ea3, 0x001e2b6a, 0x01dee07a, 0x02d255b3,
+	0x025f765a, 0x0153c393, 0x00930883, 0x039fbd4a,
+	0x01894f51, 0x0285fa98, 0x03453188, 0x00498441,
+	0x00c4a7a8, 0x03c81261, 0x0208d971, 0x01046cb8,
+	0x00000000, 0x00a12ddc, 0x01425bb8, 0x01e37664,
+	0x0284b770, 0x02259aac, 0x03c6ecc8, 0x0367c114,
+	0x01dc7bab, 0x017d5677, 0x009e2013, 0x003f0dcf,
+	0x0358ccdb, 0x03f9e107, 0x021a9763, 0x02bbbabf,
+	0x03b8f756, 0x0319da8a, 0x02faacee, 0x025b8132,
+	0x013c4026, 0x019d6dfa, 0x007e1b9e, 0x00df3642,
+	0x02648cfd, 0x02c5a121, 0x0326d745, 0x0387fa99,
+	0x00e03b8d, 0x00411651, 0x01a26035, 0x01034de9,
+	0x03a4fbe7, 0x0305d63b, 0x02e6a05f, 0x02478d83,
+	0x01204c97, 0x0181614b, 0x0062172f, 0x00c33af3,
+	0x0278804c, 0x02d9ad90, 0x033adbf4, 0x039bf628,
+	0x00fc373c, 0x005d1ae0, 0x01be6c84, 0x011f4158,
+	0x001c0cb1, 0x00bd216d, 0x015e5709, 0x01ff7ad5,
+	0x0298bbc1, 0x0239961d, 0x03dae079, 0x037bcda5,
+	0x01c0771a, 0x01615ac6, 0x00822ca2, 0x0023017e,
+	0x0344c06a, 0x03e5edb6, 0x02069bd2, 0x02a7b60e,
+	0x039ce285, 0x033dcf59, 0x02deb93d, 0x027f94e1,
+	0x011855f5, 0x01b97829, 0x005a0e4d, 0x00fb2391,
+	0x0240992e, 0x02e1b4f2, 0x0302c296, 0x03a3ef4a,
+	0x00c42e5e, 0x00650382, 0x018675e6, 0x0127583a,
+	0x002415d3, 0x0085380f, 0x01664e6b, 0x01c763b7,
+	0x02a0a2a3, 0x02018f7f, 0x03e2f91b, 0x0343d4c7,
+	0x01f86e78, 0x015943a4, 0x00ba35c0, 0x001b181c,
+	0x037cd908, 0x03ddf4d4, 0x023e82b0, 0x029faf6c,
+	0x00381962, 0x009934be, 0x017a42da, 0x01db6f06,
+	0x02bcae12, 0x021d83ce, 0x03fef5aa, 0x035fd876,
+	0x01e462c9, 0x01454f15, 0x00a63971, 0x000714ad,
+	0x0360d5b9, 0x03c1f865, 0x02228e01, 0x0283a3dd,
+	0x0380ee34, 0x0321c3e8, 0x02c2b58c, 0x02639850,
+	0x01045944, 0x01a57498, 0x004602fc, 0x00e72f20,
+	0x025c959f, 0x02fdb843, 0x031ece27, 0x03bfe3fb,
+	0x00d822ef, 0x00790f33, 0x019a7957, 0x013b548b,
+	0x03ecd041, 0x034dfd9d, 0x02ae8bf9, 0x020fa625,
+	0x01686731, 0x01c94aed, 0x002a3c89, 0x008b1155,
+	0x0230abea, 0x02918636, 0x0372f052, 0x03d3dd8e,
+	0x00b41c9a, 0x00153146, 0x01f64722, 0x01576afe,
+	0x00542717, 0x00f50acb, 0x01167caf, 0x01b75173,
+	0x02d09067, 0x0271bdbb, 0x0392cbdf, 0x0333e603,
+	0x01885cbc, 0x01297160, 0x00ca0704, 0x006b2ad8,
+	0x030cebcc, 0x03adc610, 0x024eb074, 0x02ef9da8,
+	0x00482ba6, 0x00e9067a, 0x010a701e, 0x01ab5dc2,
+	0x02cc9cd6, 0x026db10a, 0x038ec76e, 0x032feab2,
+	0x0194500d, 0x01357dd1, 0x00d60bb5, 0x00772669,
+	0x0310e77d, 0x03b1caa1, 0x0252bcc5, 0x02f39119,
+	0x03f0dcf0, 0x0351f12c, 0x02b28748, 0x0213aa94,
+	0x01746b80, 0x01d5465c, 0x00363038, 0x00971de4,
+	0x022ca75b, 0x028d8a87, 0x036efce3, 0x03cfd13f,
+	0x00a8102b, 0x00093df7, 0x01ea4b93, 0x014b664f,
+	0x007032c4, 0x00d11f18, 0x0132697c, 0x019344a0,
+	0x02f485b4, 0x0255a868, 0x03b6de0c, 0x0317f3d0,
+	0x01ac496f, 0x010d64b3, 0x00ee12d7, 0x004f3f0b,
+	0x0328fe1f, 0x0389d3c3, 0x026aa5a7, 0x02cb887b,
+	0x03c8c592, 0x0369e84e, 0x028a9e2a, 0x022bb3f6,
+	0x014c72e2, 0x01ed5f3e, 0x000e295a, 0x00af0486,
+	0x0214be39, 0x02b593e5, 0x0356e581, 0x03f7c85d,
+	0x00900949, 0x00312495, 0x01d252f1, 0x01737f2d,
+	0x03d4c923, 0x0375e4ff, 0x0296929b, 0x0237bf47,
+	0x01507e53, 0x01f1538f, 0x001225eb, 0x00b30837,
+	0x0208b288, 0x02a99f54, 0x034ae930, 0x03ebc4ec,
+	0x008c05f8, 0x002d2824, 0x01ce5e40, 0x016f739c,
+	0x006c3e75, 0x00cd13a9, 0x012e65cd, 0x018f4811,
+	0x02e88905, 0x0249a4d9, 0x03aad2bd, 0x030bff61,
+	0x01b045de, 0x01116802, 0x00f21e66, 0x005333ba,
+	0x0334f2ae, 0x0395df72, 0x0276a916, 0x02d784ca,
+	0x00000000, 0x03016bdb, 0x02d7c2fd, 0x01d6a926,
+	0x017a90b1, 0x027bfb6a, 0x03ad524c, 0x00ac3997,
+	0x02f52162, 0x01f44ab9, 0x0022e39f, 0x03238844,
+	0x038fb1d3, 0x008eda08, 0x0158732e, 0x025918f5,
+	0x013f578f, 0x023e3c54, 0x03e89572, 0x00e9fea9,
+	0x0045c73e, 0x0344ace5, 0x029205c3, 0x01936e18,
+	0x03ca76ed, 0x00cb1d36, 0x011db410, 0x021cdfcb,
+	0x02b0e65c, 0x01b18d87, 0x006724a1, 0x03664f7a,
+	0x027eaf1e, 0x017fc4c5, 0x00a96de3, 0x03a80638,
+	0x03043faf, 0x00055474, 0x01d3fd52, 0x02d29689,
+	0x008b8e7c, 0x038ae5a7, 0x025c4c81, 0x015d275a,
+	0x01f11ecd, 0x02f07516, 0x0326dc30, 0x0027b7eb,
+	0x0341f891, 0x0040934a, 0x01963a6c, 0x029751b7,
+	0x023b6820, 0x013a03fb, 0x00ecaadd, 0x03edc106,
+	0x01b4d9f3, 0x02b5b228, 0x03631b0e, 0x006270d5,
+	0x00ce4942, 0x03cf2299, 0x02198bbf, 0x0118e064,
+	0x00284b77, 0x032920ac, 0x02ff898a, 0x01fee251,
+	0x0152dbc6, 0x0253b01d, 0x0385193b, 0x008472e0,
+	0x02dd6a15, 0x01dc01ce, 0x000aa8e8, 0x030bc333,
+	0x03a7faa4, 0x00a6917f, 0x01703859, 0x02715382,
+	0x01171cf8, 0x02167723, 0x03c0de05, 0x00c1b5de,
+	0x006d8c49, 0x036ce792, 0x02ba4eb4, 0x01bb256f,
+	0x03e23d9a, 0x00e35641, 0x0135ff67, 0x023494bc,
+	0x0298ad2b, 0x0199c6f0, 0x004f6fd6, 0x034e040d,
+	0x0256e469, 0x01578fb2, 0x00812694, 0x03804d4f,
+	0x032c74d8, 0x002d1f03, 0x01fbb625, 0x02faddfe,
+	0x00a3c50b, 0x03a2aed0, 0x027407f6, 0x01756c2d,
+	0x01d955ba, 0x02d83e61, 0x030e9747, 0x000ffc9c,
+	0x0369b3e6, 0x0068d83d, 0x01be711b, 0x02bf1ac0,
+	0x02132357, 0x0112488c, 0x00c4e1aa, 0x03c58a71,
+	0x019c9284, 0x029df95f, 0x034b5079, 0x004a3ba2,
+	0x00e60235, 0x03e769ee, 0x0231c0c8, 0x0130ab13,
+	0x005096ee, 0x0351fd35, 0x02875413, 0x01863fc8,
+	0x012a065f, 0x022b6d84, 0x03fdc4a2, 0x00fcaf79,
+	0x02a5b78c, 0x01a4dc57, 0x00727571, 0x03731eaa,
+	0x03df273d, 0x00de4ce6, 0x0108e5c0, 0x02098e1b,
+	0x016fc161, 0x026eaaba, 0x03b8039c, 0x00b96847,
+	0x001551d0, 0x03143a0b, 0x02c2932d, 0x01c3f8f6,
+	0x039ae003, 0x009b8bd8, 0x014d22fe, 0x024c4925,
+	0x02e070b2, 0x01e11b69, 0x0037b24f, 0x0336d994,
+	0x022e39f0, 0x012f522b, 0x00f9fb0d, 0x03f890d6,
+	0x0354a941, 0x0055c29a, 0x01836bbc, 0x02820067,
+	0x00db1892, 0x03da7349, 0x020cda6f, 0x010db1b4,
+	0x01a18823, 0x02a0e3f8, 0x03764ade, 0x00772105,
+	0x03116e7f, 0x001005a4, 0x01c6ac82, 0x02c7c759,
+	0x026bfece, 0x016a9515, 0x00bc3c33, 0x03bd57e8,
+	0x01e44f1d, 0x02e524c6, 0x03338de0, 0x0032e63b,
+	0x009edfac, 0x039fb477, 0x02491d51, 0x0148768a,
+	0x0078dd99, 0x0379b642, 0x02af1f64, 0x01ae74bf,
+	0x01024d28, 0x020326f3, 0x03d58fd5, 0x00d4e40e,
+	0x028dfcfb, 0x018c9720, 0x005a3e06, 0x035b55dd,
+	0x03f76c4a, 0x00f60791, 0x0120aeb7, 0x0221c56c,
+	0x01478a16, 0x0246e1cd, 0x039048eb, 0x00912330,
+	0x003d1aa7, 0x033c717c, 0x02ead85a, 0x01ebb381,
+	0x03b2ab74, 0x00b3c0af, 0x01656989, 0x02640252,
+	0x02c83bc5, 0x01c9501e, 0x001ff938, 0x031e92e3,
+	0x02067287, 0x0107195c, 0x00d1b07a, 0x03d0dba1,
+	0x037ce236, 0x007d89ed, 0x01ab20cb, 0x02aa4b10,
+	0x00f353e5, 0x03f2383e, 0x02249118, 0x0125fac3,
+	0x0189c354, 0x0288a88f, 0x035e01a9, 0x005f6a72,
+	0x03392508, 0x00384ed3, 0x01eee7f5, 0x02ef8c2e,
+	0x0243b5b9, 0x0142de62, 0x00947744, 0x03951c9f,
+	0x01cc046a, 0x02cd6fb1, 0x031bc697, 0x001aad4c,
+	0x00b694db, 0x03b7ff00, 0x02615626, 0x01603dfd,
+	0x00000000, 0x038fe874, 0x03cac5a3, 0x00452dd7,
+	0x03409e0d, 0x00cf7679, 0x008a5bae, 0x0305b3da,
+	0x02542951, 0x01dbc125, 0x019eecf2, 0x02110486,
+	0x0114b75c, 0x029b5f28, 0x02de72ff, 0x01519a8b,
+	0x007d47e9, 0x03f2af9d, 0x03b7824a, 0x00386a3e,
+	0x033dd9e4, 0x00b23190, 0x00f71c47, 0x0378f433,
+	0x02296eb8, 0x01a686cc, 0x01e3ab1b, 0x026c436f,
+	0x0169f0b5, 0x02e618c1, 0x02a33516, 0x012cdd62,
+	0x00fa8fd2, 0x037567a6, 0x03304a71, 0x00bfa205,
+	0x03ba11df, 0x0035f9ab, 0x0070d47c, 0x03ff3c08,
+	0x02aea683, 0x01214ef7, 0x01646320, 0x02eb8b54,
+	0x01ee388e, 0x0261d0fa, 0x0224fd2d, 0x01ab1559,
+	0x0087c83b, 0x0308204f, 0x034d0d98, 0x00c2e5ec,
+	0x03c75636, 0x0048be42, 0x000d9395, 0x03827be1,
+	0x02d3e16a, 0x015c091e, 0x011924c9, 0x0296ccbd,
+	0x01937f67, 0x021c9713, 0x0259bac4, 0x01d652b0,
+	0x01f51fa4, 0x027af7d0, 0x023fda07, 0x01b03273,
+	0x02b581a9, 0x013a69dd, 0x017f440a, 0x02f0ac7e,
+	0x03a136f5, 0x002ede81, 0x006bf356, 0x03e41b22,
+	0x00e1a8f8, 0x036e408c, 0x032b6d5b, 0x00a4852f,
+	0x0188584d, 0x0207b039, 0x02429dee, 0x01cd759a,
+	0x02c8c640, 0x01472e34, 0x010203e3, 0x028deb97,
+	0x03dc711c, 0x00539968, 0x0016b4bf, 0x03995ccb,
+	0x009cef11, 0x03130765, 0x03562ab2, 0x00d9c2c6,
+	0x010f9076, 0x02807802, 0x02c555d5, 0x014abda1,
+	0x024f0e7b, 0x01c0e60f, 0x0185cbd8, 0x020a23ac,
+	0x035bb927, 0x00d45153, 0x00917c84, 0x031e94f0,
+	0x001b272a, 0x0394cf5e, 0x03d1e289, 0x005e0afd,
+	0x0172d79f, 0x02fd3feb, 0x02b8123c, 0x0137fa48,
+	0x02324992, 0x01bda1e6, 0x01f88c31, 0x02776445,
+	0x0326fece, 0x00a916ba, 0x00ec3b6d, 0x0363d319,
+	0x006660c3, 0x03e988b7, 0x03aca560, 0x00234d14,
+	0x03ea3f48, 0x0065d73c, 0x0020faeb, 0x03af129f,
+	0x00aaa145, 0x03254931, 0x036064e6, 0x00ef8c92,
+	0x01be1619, 0x0231fe6d, 0x0274d3ba, 0x01fb3bce,
+	0x02fe8814, 0x01716060, 0x01344db7, 0x02bba5c3,
+	0x039778a1, 0x001890d5, 0x005dbd02, 0x03d25576,
+	0x00d7e6ac, 0x03580ed8, 0x031d230f, 0x0092cb7b,
+	0x01c351f0, 0x024cb984, 0x02099453, 0x01867c27,
+	0x0283cffd, 0x010c2789, 0x01490a5e, 0x02c6e22a,
+	0x0310b09a, 0x009f58ee, 0x00da7539, 0x03559d4d,
+	0x00502e97, 0x03dfc6e3, 0x039aeb34, 0x00150340,
+	0x014499cb, 0x02cb71bf, 0x028e5c68, 0x0101b41c,
+	0x020407c6, 0x018befb2, 0x01cec265, 0x02412a11,
+	0x036df773, 0x00e21f07, 0x00a732d0, 0x0328daa4,
+	0x002d697e, 0x03a2810a, 0x03e7acdd, 0x006844a9,
+	0x0139de22, 0x02b63656, 0x02f31b81, 0x017cf3f5,
+	0x0279402f, 0x01f6a85b, 0x01b3858c, 0x023c6df8,
+	0x021f20ec, 0x0190c898, 0x01d5e54f, 0x025a0d3b,
+	0x015fbee1, 0x02d05695, 0x02957b42, 0x011a9336,
+	0x004b09bd, 0x03c4e1c9, 0x0381cc1e, 0x000e246a,
+	0x030b97b0, 0x00847fc4, 0x00c15213, 0x034eba67,
+	0x02626705, 0x01ed8f71, 0x01a8a2a6, 0x02274ad2,
+	0x0122f908, 0x02ad117c, 0x02e83cab, 0x0167d4df,
+	0x00364e54, 0x03b9a620, 0x03fc8bf7, 0x00736383,
+	0x0376d059, 0x00f9382d, 0x00bc15fa, 0x0333fd8e,
+	0x02e5af3e, 0x016a474a, 0x012f6a9d, 0x02a082e9,
+	0x01a53133, 0x022ad947, 0x026ff490, 0x01e01ce4,
+	0x00b1866f, 0x033e6e1b, 0x037b43cc, 0x00f4abb8,
+	0x03f11862, 0x007ef016, 0x003bddc1, 0x03b435b5,
+	0x0298e8d7, 0x011700a3, 0x01522d74, 0x02ddc500,
+	0x01d876da, 0x02579eae, 0x0212b379, 0x019d5b0d,
+	0x00ccc186, 0x034329f2, 0x03060425, 0x0089ec51,
+	0x038c5f8b, 0x0003b7ff, 0x00469a28, 0x03c9725c,
+};
+#endif
+
+const struct bch_def bch_2bit = {
+	.syns		= 4,
+	.generator	= { 0x4d5154b },
+	.degree		= 26,
+	.ecc_bytes	= 4,
+	.table32	= BCH_TABLE(bch_2bit_table),
+	.fold		= { 0x7e4392c000000000, 0x8a79990000000000,
+			    0xdfa9fbc000000000, 0x948d4ec000000000 }
+};
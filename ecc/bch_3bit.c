@@ -0,0 +1,552 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include "bch.h"
+
+/* 3-bit ECC over GF(2^13). Each code has its own file, so that only
+ * the tables for codes in use are linked.
+ */
+
+#ifndef BCH_NO_TABLES
+/* Slice-by-4 remainder table, generated with tools/gentab from the
+ * generator polynomial (shifted right by one bit).
+ */
+static const bch_poly_t bch_3bit_table[BCH_TABLE_SIZE] = {
+	0x0000000000, 0x35ca0f3ebd,
+	0x6b941e7d7a, 0x5e5e1143c7,
+	0x6ddd8e4719, 0x58178179a4,
+	0x0649903a63, 0x33839f04de,
+	0x614eae33df, 0x5484a10d62,
+	0x0adab04ea5, 0x3f10bf7018,
+	0x0c932074c6, 0x39592f4a7b,
+	0x67073e09bc, 0x52cd313701,
+	0x7868eeda53, 0x4da2e1e4ee,
+	0x13fcf0a729, 0x2636ff9994,
+	0x15b5609d4a, 0x207f6fa3f7,
+	0x7e217ee030, 0x4beb71de8d,
+	0x192640e98c, 0x2cec4fd731,
+	0x72b25e94f6, 0x477851aa4b,
+	0x74fbceae95, 0x4131c19028,
+	0x1f6fd0d3ef, 0x2aa5dfed52,
+	0x4a246f094b, 0x7fee6037f6,
+	0x21b0717431, 0x147a7e4a8c,
+	0x27f9e14e52, 0x1233ee70ef,
+	0x4c6dff3328, 0x79a7f00d95,
+	0x2b6ac13a94, 0x1ea0ce0429,
+	0x40fedf47ee, 0x7534d07953,
+	0x46b74f7d8d, 0x737d404330,
+	0x2d235100f7, 0x18e95e3e4a,
+	0x324c81d318, 0x07868eeda5,
+	0x59d89fae62, 0x6c129090df,
+	0x5f910f9401, 0x6a5b00aabc,
+	0x340511e97b, 0x01cf1ed7c6,
+	0x53022fe0c7, 0x66c820de7a,
+	0x3896319dbd, 0x0d5c3ea300,
+	0x3edfa1a7de, 0x0b15ae9963,
+	0x554bbfdaa4, 0x6081b0e419,
+	0x2ebd6caf7b, 0x1b776391c6,
+	0x452972d201, 0x70e37decbc,
+	0x4360e2e862, 0x76aaedd6df,
+	0x28f4fc9518, 0x1d3ef3aba5,
+	0x4ff3c29ca4, 0x7a39cda219,
+	0x2467dce1de, 0x11add3df63,
+	0x222e4cdbbd, 0x17e443e500,
+	0x49ba52a6c7, 0x7c705d987a,
+	0x56d5827528, 0x631f8d4b95,
+	0x3d419c0852, 0x088b9336ef,
+	0x3b080c3231, 0x0ec2030c8c,
+	0x509c124f4b, 0x65561d71f6,
+	0x379b2c46f7, 0x025123784a,
+	0x5c0f323b8d, 0x69c53d0530,
+	0x5a46a201ee, 0x6f8cad3f53,
+	0x31d2bc7c94, 0x0418b34229,
+	0x649903a630, 0x51530c988d,
+	0x0f0d1ddb4a, 0x3ac712e5f7,
+	0x09448de129, 0x3c8e82df94,
+	0x62d0939c53, 0x571a9ca2ee,
+	0x05d7ad95ef, 0x301da2ab52,
+	0x6e43b3e895, 0x5b89bcd628,
+	0x680a23d2f6, 0x5dc02cec4b,
+	0x039e3daf8c, 0x3654329131,
+	0x1cf1ed7c63, 0x293be242de,
+	0x7765f30119, 0x42affc3fa4,
+	0x712c633b7a, 0x44e66c05c7,
+	0x1ab87d4600, 0x2f727278bd,
+	0x7dbf434fbc, 0x48754c7101,
+	0x162b5d32c6, 0x23e1520c7b,
+	0x1062cd08a5, 0x25a8c23618,
+	0x7bf6d375df, 0x4e3cdc4b62,
+	0x5d7ad95ef6, 0x68b0d6604b,
+	0x36eec7238c, 0x0324c81d31,
+	0x30a75719ef, 0x056d582752,
+	0x5b33496495, 0x6ef9465a28,
+	0x3c34776d29, 0x09fe785394,
+	0x57a0691053, 0x626a662eee,
+	0x51e9f92a30, 0x6423f6148d,
+	0x3a7de7574a, 0x0fb7e869f7,
+	0x25123784a5, 0x10d838ba18,
+	0x4e8629f9df, 0x7b4c26c762,
+	0x48cfb9c3bc, 0x7d05b6fd01,
+	0x235ba7bec6, 0x1691a8807b,
+	0x445c99b77a, 0x71969689c7,
+	0x2fc887ca00, 0x1a0288f4bd,
+	0x298117f063, 0x1c4b18cede,
+	0x4215098d19, 0x77df06b3a4,
+	0x175eb657bd, 0x2294b96900,
+	0x7ccaa82ac7, 0x4900a7147a,
+	0x7a833810a4, 0x4f49372e19,
+	0x1117266dde, 0x24dd295363,
+	0x7610186462, 0x43da175adf,
+	0x1d84061918, 0x284e0927a5,
+	0x1bcd96237b, 0x2e07991dc6,
+	0x7059885e01, 0x45938760bc,
+	0x6f36588dee, 0x5afc57b353,
+	0x04a246f094, 0x316849ce29,
+	0x02ebd6caf7, 0x3721d9f44a,
+	0x697fc8b78d, 0x5cb5c78930,
+	0x0e78f6be31, 0x3bb2f9808c,
+	0x65ece8c34b, 0x5026e7fdf6,
+	0x63a578f928, 0x566f77c795,
+	0x0831668452, 0x3dfb69baef,
+	0x73c7b5f18d, 0x460dbacf30,
+	0x1853ab8cf7, 0x2d99a4b24a,
+	0x1e1a3bb694, 0x2bd0348829,
+	0x758e25cbee, 0x40442af553,
+	0x12891bc252, 0x274314fcef,
+	0x791d05bf28, 0x4cd70a8195,
+	0x7f5495854b, 0x4a9e9abbf6,
+	0x14c08bf831, 0x210a84c68c,
+	0x0baf5b2bde, 0x3e65541563,
+	0x603b4556a4, 0x55f14a6819,
+	0x6672d56cc7, 0x53b8da527a,
+	0x0de6cb11bd, 0x382cc42f00,
+	0x6ae1f51801, 0x5f2bfa26bc,
+	0x0175eb657b, 0x34bfe45bc6,
+	0x073c7b5f18, 0x32f67461a5,
+	0x6ca8652262, 0x59626a1cdf,
+	0x39e3daf8c6, 0x0c29d5c67b,
+	0x5277c485bc, 0x67bdcbbb01,
+	0x543e54bfdf, 0x61f45b8162,
+	0x3faa4ac2a5, 0x0a6045fc18,
+	0x58ad74cb19, 0x6d677bf5a4,
+	0x33396ab663, 0x06f36588de,
+	0x3570fa8c00, 0x00baf5b2bd,
+	0x5ee4e4f17a, 0x6b2eebcfc7,
+	0x418b342295, 0x74413b1c28,
+	0x2a1f2a5fef, 0x1fd5256152,
+	0x2c56ba658c, 0x199cb55b31,
+	0x47c2a418f6, 0x7208ab264b,
+	0x20c59a114a, 0x150f952ff7,
+	0x4b51846c30, 0x7e9b8b528d,
+	0x4d18145653, 0x78d21b68ee,
+	0x268c0a2b29, 0x1346051594,
+	0x0000000000, 0x565abdc8ab,
+	0x1640c92cbb, 0x401a74e410,
+	0x2c81925976, 0x7adb2f91dd,
+	0x3ac15b75cd, 0x6c9be6bd66,
+	0x590324b2ec, 0x0f59997a47,
+	0x4f43ed9e57, 0x19195056fc,
+	0x7582b6eb9a, 0x23d80b2331,
+	0x63c27fc721, 0x3598c20f8a,
+	0x08f3fbd835, 0x5ea946109e,
+	0x1eb332f48e, 0x48e98f3c25,
+	0x2472698143, 0x7228d449e8,
+	0x3232a0adf8, 0x64681d6553,
+	0x51f0df6ad9, 0x07aa62a272,
+	0x47b0164662, 0x11eaab8ec9,
+	0x7d714d33af, 0x2b2bf0fb04,
+	0x6b31841f14, 0x3d6b39d7bf,
+	0x11e7f7b06a, 0x47bd4a78c1,
+	0x07a73e9cd1, 0x51fd83547a,
+	0x3d6665e91c, 0x6b3cd821b7,
+	0x2b26acc5a7, 0x7d7c110d0c,
+	0x48e4d30286, 0x1ebe6eca2d,
+	0x5ea41a2e3d, 0x08fea7e696,
+	0x6465415bf0, 0x323ffc935b,
+	0x722588774b, 0x247f35bfe0,
+	0x19140c685f, 0x4f4eb1a0f4,
+	0x0f54c544e4, 0x590e788c4f,
+	0x35959e3129, 0x63cf23f982,
+	0x23d5571d92, 0x758fead539,
+	0x401728dab3, 0x164d951218,
+	0x5657e1f608, 0x000d5c3ea3,
+	0x6c96ba83c5, 0x3acc074b6e,
+	0x7ad673af7e, 0x2c8cce67d5,
+	0x23cfef60d4, 0x759552a87f,
+	0x358f264c6f, 0x63d59b84c4,
+	0x0f4e7d39a2, 0x5914c0f109,
+	0x190eb41519, 0x4f5409ddb2,
+	0x7acccbd238, 0x2c96761a93,
+	0x6c8c02fe83, 0x3ad6bf3628,
+	0x564d598b4e, 0x0017e443e5,
+	0x400d90a7f5, 0x16572d6f5e,
+	0x2b3c14b8e1, 0x7d66a9704a,
+	0x3d7cdd945a, 0x6b26605cf1,
+	0x07bd86e197, 0x51e73b293c,
+	0x11fd4fcd2c, 0x47a7f20587,
+	0x723f300a0d, 0x24658dc2a6,
+	0x647ff926b6, 0x322544ee1d,
+	0x5ebea2537b, 0x08e41f9bd0,
+	0x48fe6b7fc0, 0x1ea4d6b76b,
+	0x322818d0be, 0x6472a51815,
+	0x2468d1fc05, 0x72326c34ae,
+	0x1ea98a89c8, 0x48f3374163,
+	0x08e943a573, 0x5eb3fe6dd8,
+	0x6b2b3c6252, 0x3d7181aaf9,
+	0x7d6bf54ee9, 0x2b31488642,
+	0x47aaae3b24, 0x11f013f38f,
+	0x51ea67179f, 0x07b0dadf34,
+	0x3adbe3088b, 0x6c815ec020,
+	0x2c9b2a2430, 0x7ac197ec9b,
+	0x165a7151fd, 0x4000cc9956,
+	0x001ab87d46, 0x564005b5ed,
+	0x63d8c7ba67, 0x35827a72cc,
+	0x75980e96dc, 0x23c2b35e77,
+	0x4f5955e311, 0x1903e82bba,
+	0x59199ccfaa, 0x0f43210701,
+	0x479fdec1a8, 0x11c5630903,
+	0x51df17ed13, 0x0785aa25b8,
+	0x6b1e4c98de, 0x3d44f15075,
+	0x7d5e85b465, 0x2b04387cce,
+	0x1e9cfa7344, 0x48c647bbef,
+	0x08dc335fff, 0x5e868e9754,
+	0x321d682a32, 0x6447d5e299,
+	0x245da10689, 0x72071cce22,
+	0x4f6c25199d, 0x193698d136,
+	0x592cec3526, 0x0f7651fd8d,
+	0x63edb740eb, 0x35b70a8840,
+	0x75ad7e6c50, 0x23f7c3a4fb,
+	0x166f01ab71, 0x4035bc63da,
+	0x002fc887ca, 0x5675754f61,
+	0x3aee93f207, 0x6cb42e3aac,
+	0x2cae5adebc, 0x7af4e71617,
+	0x56782971c2, 0x002294b969,
+	0x4038e05d79, 0x16625d95d2,
+	0x7af9bb28b4, 0x2ca306e01f,
+	0x6cb972040f, 0x3ae3cfcca4,
+	0x0f7b0dc32e, 0x5921b00b85,
+	0x193bc4ef95, 0x4f6179273e,
+	0x23fa9f9a58, 0x75a02252f3,
+	0x35ba56b6e3, 0x63e0eb7e48,
+	0x5e8bd2a9f7, 0x08d16f615c,
+	0x48cb1b854c, 0x1e91a64de7,
+	0x720a40f081, 0x2450fd382a,
+	0x644a89dc3a, 0x3210341491,
+	0x0788f61b1b, 0x51d24bd3b0,
+	0x11c83f37a0, 0x479282ff0b,
+	0x2b0964426d, 0x7d53d98ac6,
+	0x3d49ad6ed6, 0x6b1310a67d,
+	0x645031a17c, 0x320a8c69d7,
+	0x7210f88dc7, 0x244a45456c,
+	0x48d1a3f80a, 0x1e8b1e30a1,
+	0x5e916ad4b1, 0x08cbd71c1a,
+	0x3d53151390, 0x6b09a8db3b,
+	0x2b13dc3f2b, 0x7d4961f780,
+	0x11d2874ae6, 0x47883a824d,
+	0x07924e665d, 0x51c8f3aef6,
+	0x6ca3ca7949, 0x3af977b1e2,
+	0x7ae30355f2, 0x2cb9be9d59,
+	0x402258203f, 0x1678e5e894,
+	0x5662910c84, 0x00382cc42f,
+	0x35a0eecba5, 0x63fa53030e,
+	0x23e027e71e, 0x75ba9a2fb5,
+	0x19217c92d3, 0x4f7bc15a78,
+	0x0f61b5be68, 0x593b0876c3,
+	0x75b7c61116, 0x23ed7bd9bd,
+	0x63f70f3dad, 0x35adb2f506,
+	0x5936544860, 0x0f6ce980cb,
+	0x4f769d64db, 0x192c20ac70,
+	0x2cb4e2a3fa, 0x7aee5f6b51,
+	0x3af42b8f41, 0x6cae9647ea,
+	0x003570fa8c, 0x566fcd3227,
+	0x1675b9d637, 0x402f041e9c,
+	0x7d443dc923, 0x2b1e800188,
+	0x6b04f4e598, 0x3d5e492d33,
+	0x51c5af9055, 0x079f1258fe,
+	0x478566bcee, 0x11dfdb7445,
+	0x2447197bcf, 0x721da4b364,
+	0x3207d05774, 0x645d6d9fdf,
+	0x08c68b22b9, 0x5e9c36ea12,
+	0x1e86420e02, 0x48dcffc6a9,
+	0x0000000000, 0x2818539a6d,
+	0x5030a734da, 0x7828f4aeb7,
+	0x1a94fcd459, 0x328caf4e34,
+	0x4aa45be083, 0x62bc087aee,
+	0x3529f9a8b2, 0x1d31aa32df,
+	0x65195e9c68, 0x4d010d0605,
+	0x2fbd057ceb, 0x07a556e686,
+	0x7f8da24831, 0x5795f1d25c,
+	0x6a53f35164, 0x424ba0cb09,
+	0x3a635465be, 0x127b07ffd3,
+	0x70c70f853d, 0x58df5c1f50,
+	0x20f7a8b1e7, 0x08effb2b8a,
+	0x5f7a0af9d6, 0x77625963bb,
+	0x0f4aadcd0c, 0x2752fe5761,
+	0x45eef62d8f, 0x6df6a5b7e2,
+	0x15de511955, 0x3dc6028338,
+	0x6e52541f25, 0x464a078548,
+	0x3e62f32bff, 0x167aa0b192,
+	0x74c6a8cb7c, 0x5cdefb5111,
+	0x24f60fffa6, 0x0cee5c65cb,
+	0x5b7badb797, 0x7363fe2dfa,
+	0x0b4b0a834d, 0x2353591920,
+	0x41ef5163ce, 0x69f702f9a3,
+	0x11dff65714, 0x39c7a5cd79,
+	0x0401a74e41, 0x2c19f4d42c,
+	0x5431007a9b, 0x7c2953e0f6,
+	0x1e955b9a18, 0x368d080075,
+	0x4ea5fcaec2, 0x66bdaf34af,
+	0x31285ee6f3, 0x19300d7c9e,
+	0x6118f9d229, 0x4900aa4844,
+	0x2bbca232aa, 0x03a4f1a8c7,
+	0x7b8c050670, 0x5394569c1d,
+	0x66511a83a7, 0x4e494919ca,
+	0x3661bdb77d, 0x1e79ee2d10,
+	0x7cc5e657fe, 0x54ddb5cd93,
+	0x2cf5416324, 0x04ed12f949,
+	0x5378e32b15, 0x7b60b0b178,
+	0x0348441fcf, 0x2b501785a2,
+	0x49ec1fff4c, 0x61f44c6521,
+	0x19dcb8cb96, 0x31c4eb51fb,
+	0x0c02e9d2c3, 0x241aba48ae,
+	0x5c324ee619, 0x742a1d7c74,
+	0x169615069a, 0x3e8e469cf7,
+	0x46a6b23240, 0x6ebee1a82d,
+	0x392b107a71, 0x113343e01c,
+	0x691bb74eab, 0x4103e4d4c6,
+	0x23bfecae28, 0x0ba7bf3445,
+	0x738f4b9af2, 0x5b9718009f,
+	0x08034e9c82, 0x201b1d06ef,
+	0x5833e9a858, 0x702bba3235,
+	0x1297b248db, 0x3a8fe1d2b6,
+	0x42a7157c01, 0x6abf46e66c,
+	0x3d2ab73430, 0x1532e4ae5d,
+	0x6d1a1000ea, 0x4502439a87,
+	0x27be4be069, 0x0fa6187a04,
+	0x778eecd4b3, 0x5f96bf4ede,
+	0x6250bdcde6, 0x4a48ee578b,
+	0x32601af93c, 0x1a78496351,
+	0x78c44119bf, 0x50dc1283d2,
+	0x28f4e62d65, 0x00ecb5b708,
+	0x5779446554, 0x7f6117ff39,
+	0x0749e3518e, 0x2f51b0cbe3,
+	0x4dedb8b10d, 0x65f5eb2b60,
+	0x1ddd1f85d7, 0x35c54c1fba,
+	0x765787baa3, 0x5e4fd420ce,
+	0x2667208e79, 0x0e7f731414,
+	0x6cc37b6efa, 0x44db28f497,
+	0x3cf3dc5a20, 0x14eb8fc04d,
+	0x437e7e1211, 0x6b662d887c,
+	0x134ed926cb, 0x3b568abca6,
+	0x59ea82c648, 0x71f2d15c25,
+	0x09da25f292, 0x21c27668ff,
+	0x1c0474ebc7, 0x341c2771aa,
+	0x4c34d3df1d, 0x642c804570,
+	0x0690883f9e, 0x2e88dba5f3,
+	0x56a02f0b44, 0x7eb87c9129,
+	0x292d8d4375, 0x0135ded918,
+	0x791d2a77af, 0x510579edc2,
+	0x33b971972c, 0x1ba1220d41,
+	0x6389d6a3f6, 0x4b9185399b,
+	0x1805d3a586, 0x301d803feb,
+	0x483574915c, 0x602d270b31,
+	0x02912f71df, 0x2a897cebb2,
+	0x52a1884505, 0x7ab9dbdf68,
+	0x2d2c2a0d34, 0x0534799759,
+	0x7d1c8d39ee, 0x5504dea383,
+	0x37b8d6d96d, 0x1fa0854300,
+	0x678871edb7, 0x4f902277da,
+	0x725620f4e2, 0x5a4e736e8f,
+	0x226687c038, 0x0a7ed45a55,
+	0x68c2dc20bb, 0x40da8fbad6,
+	0x38f27b1461, 0x10ea288e0c,
+	0x477fd95c50, 0x6f678ac63d,
+	0x174f7e688a, 0x3f572df2e7,
+	0x5deb258809, 0x75f3761264,
+	0x0ddb82bcd3, 0x25c3d126be,
+	0x10069d3904, 0x381ecea369,
+	0x40363a0dde, 0x682e6997b3,
+	0x0a9261ed5d, 0x228a327730,
+	0x5aa2c6d987, 0x72ba9543ea,
+	0x252f6491b6, 0x0d37370bdb,
+	0x751fc3a56c, 0x5d07903f01,
+	0x3fbb9845ef, 0x17a3cbdf82,
+	0x6f8b3f7135, 0x47936ceb58,
+	0x7a556e6860, 0x524d3df20d,
+	0x2a65c95cba, 0x027d9ac6d7,
+	0x60c192bc39, 0x48d9c12654,
+	0x30f13588e3, 0x18e966128e,
+	0x4f7c97c0d2, 0x6764c45abf,
+	0x1f4c30f408, 0x3754636e65,
+	0x55e86b148b, 0x7df0388ee6,
+	0x05d8cc2051, 0x2dc09fba3c,
+	0x7e54c92621, 0x564c9abc4c,
+	0x2e646e12fb, 0x067c3d8896,
+	0x64c035f278, 0x4cd8666815,
+	0x34f092c6a2, 0x1ce8c15ccf,
+	0x4b7d308e93, 0x63656314fe,
+	0x1b4d97ba49, 0x3355c42024,
+	0x51e9cc5aca, 0x79f19fc0a7,
+	0x01d96b6e10, 0x29c138f47d,
+	0x14073a7745, 0x3c1f69ed28,
+	0x44379d439f, 0x6c2fced9f2,
+	0x0e93c6a31c, 0x268b953971,
+	0x5ea36197c6, 0x76bb320dab,
+	0x212ec3dff7, 0x093690459a,
+	0x711e64eb2d, 0x5906377140,
+	0x3bba3f0bae, 0x13a26c91c3,
+	0x6b8a983f74, 0x4392cba519,
+	0x0000000000, 0x5de834bfd1,
+	0x0125dbc24f, 0x5ccdef7d9e,
+	0x024bb7849e, 0x5fa3833b4f,
+	0x036e6c46d1, 0x5e8658f900,
+	0x04976f093c, 0x597f5bb6ed,
+	0x05b2b4cb73, 0x585a8074a2,
+	0x06dcd88da2, 0x5b34ec3273,
+	0x07f9034fed, 0x5a1137f03c,
+	0x092ede1278, 0x54c6eaada9,
+	0x080b05d037, 0x55e3316fe6,
+	0x0b656996e6, 0x568d5d2937,
+	0x0a40b254a9, 0x57a886eb78,
+	0x0db9b11b44, 0x505185a495,
+	0x0c9c6ad90b, 0x51745e66da,
+	0x0ff2069fda, 0x521a32200b,
+	0x0ed7dd5d95, 0x533fe9e244,
+	0x125dbc24f0, 0x4fb5889b21,
+	0x137867e6bf, 0x4e9053596e,
+	0x10160ba06e, 0x4dfe3f1fbf,
+	0x1133d06221, 0x4cdbe4ddf0,
+	0x16cad32dcc, 0x4b22e7921d,
+	0x17ef08ef83, 0x4a073c5052,
+	0x148164a952, 0x4969501683,
+	0x15a4bf6b1d, 0x484c8bd4cc,
+	0x1b73623688, 0x469b568959,
+	0x1a56b9f4c7, 0x47be8d4b16,
+	0x1938d5b216, 0x44d0e10dc7,
+	0x181d0e7059, 0x45f53acf88,
+	0x1fe40d3fb4, 0x420c398065,
+	0x1ec1d6fdfb, 0x4329e2422a,
+	0x1dafbabb2a, 0x40478e04fb,
+	0x1c8a617965, 0x416255c6b4,
+	0x24bb7849e0, 0x79534cf631,
+	0x259ea38baf, 0x787697347e,
+	0x26f0cfcd7e, 0x7b18fb72af,
+	0x27d5140f31, 0x7a3d20b0e0,
+	0x202c1740dc, 0x7dc423ff0d,
+	0x2109cc8293, 0x7ce1f83d42,
+	0x2267a0c442, 0x7f8f947b93,
+	0x23427b060d, 0x7eaa4fb9dc,
+	0x2d95a65b98, 0x707d92e449,
+	0x2cb07d99d7, 0x7158492606,
+	0x2fde11df06, 0x72362560d7,
+	0x2efbca1d49, 0x7313fea298,
+	0x2902c952a4, 0x74eafded75,
+	0x28271290eb, 0x75cf262f3a,
+	0x2b497ed63a, 0x76a14a69eb,
+	0x2a6ca51475, 0x778491aba4,
+	0x36e6c46d10, 0x6b0ef0d2c1,
+	0x37c31faf5f, 0x6a2b2b108e,
+	0x34ad73e98e, 0x694547565f,
+	0x3588a82bc1, 0x68609c9410,
+	0x3271ab642c, 0x6f999fdbfd,
+	0x335470a663, 0x6ebc4419b2,
+	0x303a1ce0b2, 0x6dd2285f63,
+	0x311fc722fd, 0x6cf7f39d2c,
+	0x3fc81a7f68, 0x62202ec0b9,
+	0x3eedc1bd27, 0x6305f502f6,
+	0x3d83adfbf6, 0x606b994427,
+	0x3ca67639b9, 0x614e428668,
+	0x3b5f757654, 0x66b741c985,
+	0x3a7aaeb41b, 0x67929a0bca,
+	0x3914c2f2ca, 0x64fcf64d1b,
+	0x3831193085, 0x65d92d8f54,
+	0x4976f093c0, 0x149ec42c11,
+	0x48532b518f, 0x15bb1fee5e,
+	0x4b3d47175e, 0x16d573a88f,
+	0x4a189cd511, 0x17f0a86ac0,
+	0x4de19f9afc, 0x1009ab252d,
+	0x4cc44458b3, 0x112c70e762,
+	0x4faa281e62, 0x12421ca1b3,
+	0x4e8ff3dc2d, 0x1367c763fc,
+	0x40582e81b8, 0x1db01a3e69,
+	0x417df543f7, 0x1c95c1fc26,
+	0x4213990526, 0x1ffbadbaf7,
+	0x433642c769, 0x1ede7678b8,
+	0x44cf418884, 0x1927753755,
+	0x45ea9a4acb, 0x1802aef51a,
+	0x4684f60c1a, 0x1b6cc2b3cb,
+	0x47a12dce55, 0x1a49197184,
+	0x5b2b4cb730, 0x06c37808e1,
+	0x5a0e97757f, 0x07e6a3caae,
+	0x5960fb33ae, 0x0488cf8c7f,
+	0x584520f1e1, 0x05ad144e30,
+	0x5fbc23be0c, 0x02541701dd,
+	0x5e99f87c43, 0x0371ccc392,
+	0x5df7943a92, 0x001fa08543,
+	0x5cd24ff8dd, 0x013a7b470c,
+	0x520592a548, 0x0feda61a99,
+	0x5320496707, 0x0ec87dd8d6,
+	0x504e2521d6, 0x0da6119e07,
+	0x516bfee399, 0x0c83ca5c48,
+	0x5692fdac74, 0x0b7ac913a5,
+	0x57b7266e3b, 0x0a5f12d1ea,
+	0x54d94a28ea, 0x09317e973b,
+	0x55fc91eaa5, 0x0814a55574,
+	0x6dcd88da20, 0x3025bc65f1,
+	0x6ce853186f, 0x310067a7be,
+	0x6f863f5ebe, 0x326e0be16f,
+	0x6ea3e49cf1, 0x334bd02320,
+	0x695ae7d31c, 0x34b2d36ccd,
+	0x687f3c1153, 0x359708ae82,
+	0x6b11505782, 0x36f964e853,
+	0x6a348b95cd, 0x37dcbf2a1c,
+	0x64e356c858, 0x390b627789,
+	0x65c68d0a17, 0x382eb9b5c6,
+	0x66a8e14cc6, 0x3b40d5f317,
+	0x678d3a8e89, 0x3a650e3158,
+	0x607439c164, 0x3d9c0d7eb5,
+	0x6151e2032b, 0x3cb9d6bcfa,
+	0x623f8e45fa, 0x3fd7bafa2b,
+	0x631a5587b5, 0x3ef2613864,
+	0x7f9034fed0, 0x2278004101,
+	0x7eb5ef3c9f, 0x235ddb834e,
+	0x7ddb837a4e, 0x2033b7c59f,
+	0x7cfe58b801, 0x21166c07d0,
+	0x7b075bf7ec, 0x26ef6f483d,
+	0x7a228035a3, 0x27cab48a72,
+	0x794cec7372, 0x24a4d8cca3,
+	0x786937b13d, 0x2581030eec,
+	0x76beeaeca8, 0x2b56de5379,
+	0x779b312ee7, 0x2a73059136,
+	0x74f55d6836, 0x291d69d7e7,
+	0x75d086aa79, 0x2838b215a8,
+	0x722985e594, 0x2fc1b15a45,
+	0x730c5e27db, 0x2ee46a980a,
+	0x706232610a, 0x2d8a06dedb,
+	0x7147e9a345, 0x2cafdd1c94,
+};
+#endif
+
+const struct bch_def bch_3bit = {
+	.syns		= 6,
+	.generator	= { 0xbaf5b2bded },
+	.degree		= 39,
+	.ecc_bytes	= 5,
+	.table		= BCH_TABLE(bch_3bit_table),
+	.fold		= { 0x304d098740000000, 0xd8f245bb3c000000,
+			    0x56eaa7a5ae000000, 0x9ede5fddc2000000 }
+};
@@ -0,0 +1,552 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include "bch.h"
+
+/* 4-bit ECC over GF(2^13). Each code has its own file, so that only
+ * the tables for codes in use are linked.
+ */
+
+#ifndef BCH_NO_TABLES
+/* Slice-by-4 remainder table, generated with tools/gentab from the
+ * generator polynomial (shifted right by one bit).
+ */
+static const bch_poly_t bch_4bit_table[BCH_TABLE_SIZE] = {
+	0x0000000000000, 0x98bc3bc50597b,
+	0x745b73b0b345d, 0xece74875b6d26,
+	0xe8b6e761668ba, 0x700adca4631c1,
+	0x9ced94d1d5ce7, 0x0451af14d059c,
+	0x944ecaf8757df, 0x0cf2f13d70ea4,
+	0xe015b948c6382, 0x78a9828dc3af9,
+	0x7cf82d9913f65, 0xe444165c1661e,
+	0x08a35e29a0b38, 0x901f65eca5243,
+	0x6dbe91ca52915, 0xf502aa0f5706e,
+	0x19e5e27ae1d48, 0x8159d9bfe4433,
+	0x850876ab341af, 0x1db44d6e318d4,
+	0xf153051b875f2, 0x69ef3ede82c89,
+	0xf9f05b3227eca, 0x614c60f7227b1,
+	0x8dab288294a97, 0x15171347913ec,
+	0x1146bc5341670, 0x89fa879644f0b,
+	0x651dcfe3f222d, 0xfda1f426f7b56,
+	0xdb7d2394a522a, 0x43c11851a0b51,
+	0xaf26502416677, 0x379a6be113f0c,
+	0x33cbc4f5c3a90, 0xab77ff30c63eb,
+	0x4790b74570ecd, 0xdf2c8c80757b6,
+	0x4f33e96cd05f5, 0xd78fd2a9d5c8e,
+	0x3b689adc631a8, 0xa3d4a119668d3,
+	0xa7850e0db6d4f, 0x3f3935c8b3434,
+	0xd3de7dbd05912, 0x4b62467800069,
+	0xb6c3b25ef7b3f, 0x2e7f899bf2244,
+	0xc298c1ee44f62, 0x5a24fa2b41619,
+	0x5e75553f91385, 0xc6c96efa94afe,
+	0x2a2e268f227d8, 0xb2921d4a27ea3,
+	0x228d78a682ce0, 0xba3143638759b,
+	0x56d60b16318bd, 0xce6a30d3341c6,
+	0xca3b9fc7e445a, 0x5287a402e1d21,
+	0xbe60ec7757007, 0x26dcd7b25297c,
+	0xf3d94313f22ff, 0x6b6578d6f7b84,
+	0x878230a3416a2, 0x1f3e0b6644fd9,
+	0x1b6fa47294a45, 0x83d39fb79133e,
+	0x6f34d7c227e18, 0xf788ec0722763,
+	0x679789eb87520, 0xff2bb22e82c5b,
+	0x13ccfa5b3417d, 0x8b70c19e31806,
+	0x8f216e8ae1d9a, 0x179d554fe44e1,
+	0xfb7a1d3a529c7, 0x63c626ff570bc,
+	0x9e67d2d9a0bea, 0x06dbe91ca5291,
+	0xea3ca16913fb7, 0x72809aac166cc,
+	0x76d135b8c6350, 0xee6d0e7dc3a2b,
+	0x028a46087570d, 0x9a367dcd70e76,
+	0x0a291821d5c35, 0x929523e4d054e,
+	0x7e726b9166868, 0xe6ce505463113,
+	0xe29fff40b348f, 0x7a23c485b6df4,
+	0x96c48cf0000d2, 0x0e78b735059a9,
+	0x28a46087570d5, 0xb0185b42529ae,
+	0x5cff1337e4488, 0xc44328f2e1df3,
+	0xc01287e63186f, 0x58aebc2334114,
+	0xb449f45682c32, 0x2cf5cf9387549,
+	0xbceaaa7f2270a, 0x245691ba27e71,
+	0xc8b1d9cf91357, 0x500de20a94a2c,
+	0x545c4d1e44fb0, 0xcce076db416cb,
+	0x20073eaef7bed, 0xb8bb056bf2296,
+	0x451af14d059c0, 0xdda6ca88000bb,
+	0x314182fdb6d9d, 0xa9fdb938b34e6,
+	0xadac162c6317a, 0x35102de966801,
+	0xd9f7659cd0527, 0x414b5e59d5c5c,
+	0xd1543bb570e1f, 0x49e8007075764,
+	0xa50f4805c3a42, 0x3db373c0c6339,
+	0x39e2dcd4166a5, 0xa15ee71113fde,
+	0x4db9af64a52f8, 0xd50594a1a0b83,
+	0xa291821d5c355, 0x3a2db9d859a2e,
+	0xd6caf1adef708, 0x4e76ca68eae73,
+	0x4a27657c3abef, 0xd29b5eb93f294,
+	0x3e7c16cc89fb2, 0xa6c02d098c6c9,
+	0x36df48e52948a, 0xae6373202cdf1,
+	0x42843b559a0d7, 0xda3800909f9ac,
+	0xde69af844fc30, 0x46d594414a54b,
+	0xaa32dc34fc86d, 0x328ee7f1f9116,
+	0xcf2f13d70ea40, 0x579328120b33b,
+	0xbb746067bde1d, 0x23c85ba2b8766,
+	0x2799f4b6682fa, 0xbf25cf736db81,
+	0x53c28706db6a7, 0xcb7ebcc3defdc,
+	0x5b61d92f7bd9f, 0xc3dde2ea7e4e4,
+	0x2f3aaa9fc89c2, 0xb786915acd0b9,
+	0xb3d73e4e1d525, 0x2b6b058b18c5e,
+	0xc78c4dfeae178, 0x5f30763bab803,
+	0x79eca189f917f, 0xe1509a4cfc804,
+	0x0db7d2394a522, 0x950be9fc4fc59,
+	0x915a46e89f9c5, 0x09e67d2d9a0be,
+	0xe50135582cd98, 0x7dbd0e9d294e3,
+	0xeda26b718c6a0, 0x751e50b489fdb,
+	0x99f918c13f2fd, 0x014523043ab86,
+	0x05148c10eae1a, 0x9da8b7d5ef761,
+	0x714fffa059a47, 0xe9f3c4655c33c,
+	0x14523043ab86a, 0x8cee0b86ae111,
+	0x600943f318c37, 0xf8b578361d54c,
+	0xfce4d722cd0d0, 0x6458ece7c89ab,
+	0x88bfa4927e48d, 0x10039f577bdf6,
+	0x801cfabbdefb5, 0x18a0c17edb6ce,
+	0xf447890b6dbe8, 0x6cfbb2ce68293,
+	0x68aa1ddab870f, 0xf016261fbde74,
+	0x1cf16e6a0b352, 0x844d55af0ea29,
+	0x5148c10eae1aa, 0xc9f4facbab8d1,
+	0x2513b2be1d5f7, 0xbdaf897b18c8c,
+	0xb9fe266fc8910, 0x21421daacd06b,
+	0xcda555df7bd4d, 0x55196e1a7e436,
+	0xc5060bf6db675, 0x5dba3033def0e,
+	0xb15d784668228, 0x29e143836db53,
+	0x2db0ec97bdecf, 0xb50cd752b87b4,
+	0x59eb9f270ea92, 0xc157a4e20b3e9,
+	0x3cf650c4fc8bf, 0xa44a6b01f91c4,
+	0x48ad23744fce2, 0xd01118b14a599,
+	0xd440b7a59a005, 0x4cfc8c609f97e,
+	0xa01bc41529458, 0x38a7ffd02cd23,
+	0xa8b89a3c89f60, 0x3004a1f98c61b,
+	0xdce3e98c3ab3d, 0x445fd2493f246,
+	0x400e7d5def7da, 0xd8b24698eaea1,
+	0x34550eed5c387, 0xace9352859afc,
+	0x8a35e29a0b380, 0x1289d95f0eafb,
+	0xfe6e912ab87dd, 0x66d2aaefbdea6,
+	0x628305fb6db3a, 0xfa3f3e3e68241,
+	0x16d8764bdef67, 0x8e644d8edb61c,
+	0x1e7b28627e45f, 0x86c713a77bd24,
+	0x6a205bd2cd002, 0xf29c6017c8979,
+	0xf6cdcf0318ce5, 0x6e71f4c61d59e,
+	0x8296bcb3ab8b8, 0x1a2a8776ae1c3,
+	0xe78b735059a95, 0x7f3748955c3ee,
+	0x93d000e0eaec8, 0x0b6c3b25ef7b3,
+	0x0f3d94313f22f, 0x9781aff43ab54,
+	0x7b66e7818c672, 0xe3dadc4489f09,
+	0x73c5b9a82cd4a, 0xeb79826d29431,
+	0x079eca189f917, 0x9f22f1dd9a06c,
+	0x9b735ec94a5f0, 0x03cf650c4fc8b,
+	0xef282d79f91ad, 0x779416bcfc8d6,
+	0x0000000000000, 0x3d2bcffb03360,
+	0x7a579ff6066c0, 0x477c500d055a0,
+	0xf4af3fec0cd80, 0xc984f0170fee0,
+	0x8ef8a01a0ab40, 0xb3d36fe109820,
+	0xac7d7be2a1dab, 0x9156b419a2ecb,
+	0xd62ae414a7b6b, 0xeb012befa480b,
+	0x58d2440ead02b, 0x65f98bf5ae34b,
+	0x2285dbf8ab6eb, 0x1fae1403a858b,
+	0x1dd9f3fffbdfd, 0x20f23c04f8e9d,
+	0x678e6c09fdb3d, 0x5aa5a3f2fe85d,
+	0xe976cc13f707d, 0xd45d03e8f431d,
+	0x932153e5f16bd, 0xae0a9c1ef25dd,
+	0xb1a4881d5a056, 0x8c8f47e659336,
+	0xcbf317eb5c696, 0xf6d8d8105f5f6,
+	0x450bb7f156dd6, 0x7820780a55eb6,
+	0x3f5c280750b16, 0x0277e7fc53876,
+	0x3bb3e7fff7bfa, 0x06982804f489a,
+	0x41e47809f1d3a, 0x7ccfb7f2f2e5a,
+	0xcf1cd813fb67a, 0xf23717e8f851a,
+	0xb54b47e5fd0ba, 0x8860881efe3da,
+	0x97ce9c1d56651, 0xaae553e655531,
+	0xed9903eb50091, 0xd0b2cc10533f1,
+	0x6361a3f15abd1, 0x5e4a6c0a598b1,
+	0x19363c075cd11, 0x241df3fc5fe71,
+	0x266a14000c607, 0x1b41dbfb0f567,
+	0x5c3d8bf60a0c7, 0x6116440d093a7,
+	0xd2c52bec00b87, 0xefeee417038e7,
+	0xa892b41a06d47, 0x95b97be105e27,
+	0x8a176fe2adbac, 0xb73ca019ae8cc,
+	0xf040f014abd6c, 0xcd6b3fefa8e0c,
+	0x7eb8500ea162c, 0x43939ff5a254c,
+	0x04efcff8a70ec, 0x39c40003a438c,
+	0x7767cfffef7f4, 0x4a4c0004ec494,
+	0x0d305009e9134, 0x301b9ff2ea254,
+	0x83c8f013e3a74, 0xbee33fe8e0914,
+	0xf99f6fe5e5cb4, 0xc4b4a01ee6fd4,
+	0xdb1ab41d4ea5f, 0xe6317be64d93f,
+	0xa14d2beb48c9f, 0x9c66e4104bfff,
+	0x2fb58bf1427df, 0x129e440a414bf,
+	0x55e214074411f, 0x68c9dbfc4727f,
+	0x6abe3c0014a09, 0x5795f3fb17969,
+	0x10e9a3f612cc9, 0x2dc26c0d11fa9,
+	0x9e1103ec18789, 0xa33acc171b4e9,
+	0xe4469c1a1e149, 0xd96d53e11d229,
+	0xc6c347e2b57a2, 0xfbe88819b64c2,
+	0xbc94d814b3162, 0x81bf17efb0202,
+	0x326c780eb9a22, 0x0f47b7f5ba942,
+	0x483be7f8bfce2, 0x75102803bcf82,
+	0x4cd4280018c0e, 0x71ffe7fb1bf6e,
+	0x3683b7f61eace, 0x0ba8780d1d9ae,
+	0xb87b17ec1418e, 0x8550d817172ee,
+	0xc22c881a1274e, 0xff0747e11142e,
+	0xe0a953e2b91a5, 0xdd829c19ba2c5,
+	0x9afecc14bf765, 0xa7d503efbc405,
+	0x14066c0eb5c25, 0x292da3f5b6f45,
+	0x6e51f3f8b3ae5, 0x537a3c03b0985,
+	0x510ddbffe31f3, 0x6c261404e0293,
+	0x2b5a4409e5733, 0x16718bf2e6453,
+	0xa5a2e413efc73, 0x98892be8ecf13,
+	0xdff57be5e9ab3, 0xe2deb41eea9d3,
+	0xfd70a01d42c58, 0xc05b6fe641f38,
+	0x87273feb44a98, 0xba0cf010479f8,
+	0x09df9ff14e1d8, 0x34f4500a4d2b8,
+	0x7388000748718, 0x4ea3cffc4b478,
+	0xeecf9fffdefe8, 0xd3e45004ddc88,
+	0x94980009d8928, 0xa9b3cff2dba48,
+	0x1a60a013d2268, 0x274b6fe8d1108,
+	0x60373fe5d44a8, 0x5d1cf01ed77c8,
+	0x42b2e41d7f243, 0x7f992be67c123,
+	0x38e57beb79483, 0x05ceb4107a7e3,
+	0xb61ddbf173fc3, 0x8b36140a70ca3,
+	0xcc4a440775903, 0xf1618bfc76a63,
+	0xf3166c0025215, 0xce3da3fb26175,
+	0x8941f3f6234d5, 0xb46a3c0d207b5,
+	0x07b953ec29f95, 0x3a929c172acf5,
+	0x7deecc1a2f955, 0x40c503e12ca35,
+	0x5f6b17e284fbe, 0x6240d81987cde,
+	0x253c88148297e, 0x181747ef81a1e,
+	0xabc4280e8823e, 0x96efe7f58b15e,
+	0xd193b7f88e4fe, 0xecb878038d79e,
+	0xd57c780029412, 0xe857b7fb2a772,
+	0xaf2be7f62f2d2, 0x9200280d2c1b2,
+	0x21d347ec25992, 0x1cf8881726af2,
+	0x5b84d81a23f52, 0x66af17e120c32,
+	0x790103e2889b9, 0x442acc198bad9,
+	0x03569c148ef79, 0x3e7d53ef8dc19,
+	0x8dae3c0e84439, 0xb085f3f587759,
+	0xf7f9a3f8822f9, 0xcad26c0381199,
+	0xc8a58bffd29ef, 0xf58e4404d1a8f,
+	0xb2f21409d4f2f, 0x8fd9dbf2d7c4f,
+	0x3c0ab413de46f, 0x01217be8dd70f,
+	0x465d2be5d82af, 0x7b76e41edb1cf,
+	0x64d8f01d73444, 0x59f33fe670724,
+	0x1e8f6feb75284, 0x23a4a010761e4,
+	0x9077cff17f9c4, 0xad5c000a7caa4,
+	0xea20500779f04, 0xd70b9ffc7ac64,
+	0x99a850003181c, 0xa4839ffb32b7c,
+	0xe3ffcff637edc, 0xded4000d34dbc,
+	0x6d076fec3d59c, 0x502ca0173e6fc,
+	0x1750f01a3b35c, 0x2a7b3fe13803c,
+	0x35d52be2905b7, 0x08fee419936d7,
+	0x4f82b41496377, 0x72a97bef95017,
+	0xc17a140e9c837, 0xfc51dbf59fb57,
+	0xbb2d8bf89aef7, 0x8606440399d97,
+	0x8471a3ffca5e1, 0xb95a6c04c9681,
+	0xfe263c09cc321, 0xc30df3f2cf041,
+	0x70de9c13c6861, 0x4df553e8c5b01,
+	0x0a8903e5c0ea1, 0x37a2cc1ec3dc1,
+	0x280cd81d6b84a, 0x152717e668b2a,
+	0x525b47eb6de8a, 0x6f7088106edea,
+	0xdca3e7f1675ca, 0xe188280a646aa,
+	0xa6f478076130a, 0x9bdfb7fc6206a,
+	0xa21bb7ffc63e6, 0x9f307804c5086,
+	0xd84c2809c0526, 0xe567e7f2c3646,
+	0x56b48813cae66, 0x6b9f47e8c9d06,
+	0x2ce317e5cc8a6, 0x11c8d81ecfbc6,
+	0x0e66cc1d67e4d, 0x334d03e664d2d,
+	0x743153eb6188d, 0x491a9c1062bed,
+	0xfac9f3f16b3cd, 0xc7e23c0a680ad,
+	0x809e6c076d50d, 0xbdb5a3fc6e66d,
+	0xbfc244003de1b, 0x82e98bfb3ed7b,
+	0xc595dbf63b8db, 0xf8be140d38bbb,
+	0x4b6d7bec3139b, 0x7646b417320fb,
+	0x313ae41a3755b, 0x0c112be13463b,
+	0x13bf3fe29c3b0, 0x2e94f0199f0d0,
+	0x69e8a0149a570, 0x54c36fef99610,
+	0xe710000e90e30, 0xda3bcff593d50,
+	0x9d479ff8968f0, 0xa06c500395b90,
+	0x0000000000000, 0x28994b48ac0e6,
+	0x51329691581cc, 0x79abddd9f412a,
+	0xa2652d22b0398, 0x8afc666a1c37e,
+	0xf357bbb3e8254, 0xdbcef0fb442b2,
+	0x01e95e7fd819b, 0x297015377417d,
+	0x50dbc8ee80057, 0x784283a62c0b1,
+	0xa38c735d68203, 0x8b153815c42e5,
+	0xf2bee5cc303cf, 0xda27ae849c329,
+	0x03d2bcffb0336, 0x2b4bf7b71c3d0,
+	0x52e02a6ee82fa, 0x7a7961264421c,
+	0xa1b791dd000ae, 0x892eda95ac048,
+	0xf085074c58162, 0xd81c4c04f4184,
+	0x023be280682ad, 0x2aa2a9c8c424b,
+	0x5309741130361, 0x7b903f599c387,
+	0xa05ecfa2d8135, 0x88c784ea741d3,
+	0xf16c5933800f9, 0xd9f5127b2c01f,
+	0x07a579ff6066c, 0x2f3c32b7cc68a,
+	0x5697ef6e387a0, 0x7e0ea42694746,
+	0xa5c054ddd05f4, 0x8d591f957c512,
+	0xf4f2c24c88438, 0xdc6b8904244de,
+	0x064c2780b87f7, 0x2ed56cc814711,
+	0x577eb111e063b, 0x7fe7fa594c6dd,
+	0xa4290aa20846f, 0x8cb041eaa4489,
+	0xf51b9c33505a3, 0xdd82d77bfc545,
+	0x0477c500d055a, 0x2cee8e487c5bc,
+	0x5545539188496, 0x7ddc18d924470,
+	0xa612e822606c2, 0x8e8ba36acc624,
+	0xf7207eb33870e, 0xdfb935fb947e8,
+	0x059e9b7f084c1, 0x2d07d037a4427,
+	0x54ac0dee5050d, 0x7c3546a6fc5eb,
+	0xa7fbb65db8759, 0x8f62fd15147bf,
+	0xf6c920cce0695, 0xde506b844c673,
+	0x0f4af3fec0cd8, 0x27d3b8b66cc3e,
+	0x5e78656f98d14, 0x76e12e2734df2,
+	0xad2fdedc70f40, 0x85b69594dcfa6,
+	0xfc1d484d28e8c, 0xd484030584e6a,
+	0x0ea3ad8118d43, 0x263ae6c9b4da5,
+	0x5f913b1040c8f, 0x77087058ecc69,
+	0xacc680a3a8edb, 0x845fcbeb04e3d,
+	0xfdf41632f0f17, 0xd56d5d7a5cff1,
+	0x0c984f0170fee, 0x24010449dcf08,
+	0x5daad99028e22, 0x753392d884ec4,
+	0xaefd6223c0c76, 0x8664296b6cc90,
+	0xffcff4b298dba, 0xd756bffa34d5c,
+	0x0d71117ea8e75, 0x25e85a3604e93,
+	0x5c4387eff0fb9, 0x74dacca75cf5f,
+	0xaf143c5c18ded, 0x878d7714b4d0b,
+	0xfe26aacd40c21, 0xd6bfe185eccc7,
+	0x08ef8a01a0ab4, 0x2076c1490ca52,
+	0x59dd1c90f8b78, 0x714457d854b9e,
+	0xaa8aa7231092c, 0x8213ec6bbc9ca,
+	0xfbb831b2488e0, 0xd3217afae4806,
+	0x0906d47e78b2f, 0x219f9f36d4bc9,
+	0x583442ef20ae3, 0x70ad09a78ca05,
+	0xab63f95cc88b7, 0x83fab21464851,
+	0xfa516fcd9097b, 0xd2c824853c99d,
+	0x0b3d36fe10982, 0x23a47db6bc964,
+	0x5a0fa06f4884e, 0x7296eb27e48a8,
+	0xa9581bdca0a1a, 0x81c150940cafc,
+	0xf86a8d4df8bd6, 0xd0f3c60554b30,
+	0x0ad46881c8819, 0x224d23c9648ff,
+	0x5be6fe10909d5, 0x737fb5583c933,
+	0xa8b145a378b81, 0x80280eebd4b67,
+	0xf983d33220a4d, 0xd11a987a8caab,
+	0x1e95e7fd819b0, 0x360cacb52d956,
+	0x4fa7716cd987c, 0x673e3a247589a,
+	0xbcf0cadf31a28, 0x946981979dace,
+	0xedc25c4e69be4, 0xc55b1706c5b02,
+	0x1f7cb9825982b, 0x37e5f2caf58cd,
+	0x4e4e2f13019e7, 0x66d7645bad901,
+	0xbd1994a0e9bb3, 0x9580dfe845b55,
+	0xec2b0231b1a7f, 0xc4b249791da99,
+	0x1d475b0231a86, 0x35de104a9da60,
+	0x4c75cd9369b4a, 0x64ec86dbc5bac,
+	0xbf2276208191e, 0x97bb3d682d9f8,
+	0xee10e0b1d98d2, 0xc689abf975834,
+	0x1cae057de9b1d, 0x34374e3545bfb,
+	0x4d9c93ecb1ad1, 0x6505d8a41da37,
+	0xbecb285f59885, 0x96526317f5863,
+	0xeff9bece01949, 0xc760f586ad9af,
+	0x19309e02e1fdc, 0x31a9d54a4df3a,
+	0x48020893b9e10, 0x609b43db15ef6,
+	0xbb55b32051c44, 0x93ccf868fdca2,
+	0xea6725b109d88, 0xc2fe6ef9a5d6e,
+	0x18d9c07d39e47, 0x30408b3595ea1,
+	0x49eb56ec61f8b, 0x61721da4cdf6d,
+	0xbabced5f89ddf, 0x9225a61725d39,
+	0xeb8e7bced1c13, 0xc31730867dcf5,
+	0x1ae222fd51cea, 0x327b69b5fdc0c,
+	0x4bd0b46c09d26, 0x6349ff24a5dc0,
+	0xb8870fdfe1f72, 0x901e44974df94,
+	0xe9b5994eb9ebe, 0xc12cd20615e58,
+	0x1b0b7c8289d71, 0x339237ca25d97,
+	0x4a39ea13d1cbd, 0x62a0a15b7dc5b,
+	0xb96e51a039ee9, 0x91f71ae895e0f,
+	0xe85cc73161f25, 0xc0c58c79cdfc3,
+	0x11df140341568, 0x39465f4bed58e,
+	0x40ed8292194a4, 0x6874c9dab5442,
+	0xb3ba3921f16f0, 0x9b2372695d616,
+	0xe288afb0a973c, 0xca11e4f8057da,
+	0x10364a7c994f3, 0x38af013435415,
+	0x4104dcedc153f, 0x699d97a56d5d9,
+	0xb253675e2976b, 0x9aca2c168578d,
+	0xe361f1cf716a7, 0xcbf8ba87dd641,
+	0x120da8fcf165e, 0x3a94e3b45d6b8,
+	0x433f3e6da9792, 0x6ba6752505774,
+	0xb06885de415c6, 0x98f1ce96ed520,
+	0xe15a134f1940a, 0xc9c35807b54ec,
+	0x13e4f683297c5, 0x3b7dbdcb85723,
+	0x42d6601271609, 0x6a4f2b5add6ef,
+	0xb181dba19945d, 0x991890e9354bb,
+	0xe0b34d30c1591, 0xc82a06786d577,
+	0x167a6dfc21304, 0x3ee326b48d3e2,
+	0x4748fb6d792c8, 0x6fd1b025d522e,
+	0xb41f40de9109c, 0x9c860b963d07a,
+	0xe52dd64fc9150, 0xcdb49d07651b6,
+	0x17933383f929f, 0x3f0a78cb55279,
+	0x46a1a512a1353, 0x6e38ee5a0d3b5,
+	0xb5f61ea149107, 0x9d6f55e9e51e1,
+	0xe4c48830110cb, 0xcc5dc378bd02d,
+	0x15a8d10391032, 0x3d319a4b3d0d4,
+	0x449a4792c91fe, 0x6c030cda65118,
+	0xb7cdfc21213aa, 0x9f54b7698d34c,
+	0xe6ff6ab079266, 0xce6621f8d5280,
+	0x14418f7c491a9, 0x3cd8c434e514f,
+	0x457319ed11065, 0x6dea52a5bd083,
+	0xb624a25ef9231, 0x9ebde916552d7,
+	0xe71634cfa13fd, 0xcf8f7f870d31b,
+	0x0000000000000, 0x16f0ef00965a7,
+	0x2de1de012cb4e, 0x3b113101baee9,
+	0x5bc3bc025969c, 0x4d335302cf33b,
+	0x7622620375dd2, 0x60d28d03e3875,
+	0xb7877804b2d38, 0xa17797042489f,
+	0x9a66a6059e676, 0x8c964905083d1,
+	0xec44c406ebba4, 0xfab42b067de03,
+	0xc1a51a07c70ea, 0xd755f5075154d,
+	0x2a2df433ddcdb, 0x3cdd1b334b97c,
+	0x07cc2a32f1795, 0x113cc53267232,
+	0x71ee483184a47, 0x671ea73112fe0,
+	0x5c0f9630a8109, 0x4aff79303e4ae,
+	0x9daa8c376f1e3, 0x8b5a6337f9444,
+	0xb04b523643aad, 0xa6bbbd36d5f0a,
+	0xc66930353677f, 0xd099df35a02d8,
+	0xeb88ee341ac31, 0xfd7801348c996,
+	0x545be867bb9b6, 0x42ab07672dc11,
+	0x79ba3666972f8, 0x6f4ad9660175f,
+	0x0f985465e2f2a, 0x1968bb6574a8d,
+	0x22798a64ce464, 0x34896564581c3,
+	0xe3dc90630948e, 0xf52c7f639f129,
+	0xce3d4e6225fc0, 0xd8cda162b3a67,
+	0xb81f2c6150212, 0xaeefc361c67b5,
+	0x95fef2607c95c, 0x830e1d60eacfb,
+	0x7e761c546656d, 0x6886f354f00ca,
+	0x5397c2554ae23, 0x45672d55dcb84,
+	0x25b5a0563f3f1, 0x33454f56a9656,
+	0x08547e57138bf, 0x1ea4915785d18,
+	0xc9f16450d4855, 0xdf018b5042df2,
+	0xe410ba51f831b, 0xf2e055516e6bc,
+	0x9232d8528dec9, 0x84c237521bb6e,
+	0xbfd30653a1587, 0xa923e95337020,
+	0xa8b7d0cf7736c, 0xbe473fcfe16cb,
+	0x85560ece5b822, 0x93a6e1cecdd85,
+	0xf3746ccd2e5f0, 0xe58483cdb8057,
+	0xde95b2cc02ebe, 0xc8655dcc94b19,
+	0x1f30a8cbc5e54, 0x09c047cb53bf3,
+	0x32d176cae951a, 0x242199ca7f0bd,
+	0x44f314c99c8c8, 0x5203fbc90ad6f,
+	0x6912cac8b0386, 0x7fe225c826621,
+	0x829a24fcaafb7, 0x946acbfc3ca10,
+	0xaf7bfafd864f9, 0xb98b15fd1015e,
+	0xd95998fef392b, 0xcfa977fe65c8c,
+	0xf4b846ffdf265, 0xe248a9ff497c2,
+	0x351d5cf81828f, 0x23edb3f88e728,
+	0x18fc82f9349c1, 0x0e0c6df9a2c66,
+	0x6edee0fa41413, 0x782e0ffad71b4,
+	0x433f3efb6df5d, 0x55cfd1fbfbafa,
+	0xfcec38a8ccada, 0xea1cd7a85af7d,
+	0xd10de6a9e0194, 0xc7fd09a976433,
+	0xa72f84aa95c46, 0xb1df6baa039e1,
+	0x8ace5aabb9708, 0x9c3eb5ab2f2af,
+	0x4b6b40ac7e7e2, 0x5d9baface8245,
+	0x668a9ead52cac, 0x707a71adc490b,
+	0x10a8fcae2717e, 0x065813aeb14d9,
+	0x3d4922af0ba30, 0x2bb9cdaf9df97,
+	0xd6c1cc9b11601, 0xc031239b873a6,
+	0xfb20129a3dd4f, 0xedd0fd9aab8e8,
+	0x8d0270994809d, 0x9bf29f99de53a,
+	0xa0e3ae9864bd3, 0xb6134198f2e74,
+	0x6146b49fa3b39, 0x77b65b9f35e9e,
+	0x4ca76a9e8f077, 0x5a57859e195d0,
+	0x3a85089dfada5, 0x2c75e79d6c802,
+	0x1764d69cd66eb, 0x0194399c4034c,
+	0x144ca5a456073, 0x02bc4aa4c05d4,
+	0x39ad7ba57ab3d, 0x2f5d94a5ece9a,
+	0x4f8f19a60f6ef, 0x597ff6a699348,
+	0x626ec7a723da1, 0x749e28a7b5806,
+	0xa3cbdda0e4d4b, 0xb53b32a0728ec,
+	0x8e2a03a1c8605, 0x98daeca15e3a2,
+	0xf80861a2bdbd7, 0xeef88ea22be70,
+	0xd5e9bfa391099, 0xc31950a30753e,
+	0x3e6151978bca8, 0x2891be971d90f,
+	0x13808f96a77e6, 0x0570609631241,
+	0x65a2ed95d2a34, 0x7352029544f93,
+	0x48433394fe17a, 0x5eb3dc94684dd,
+	0x89e6299339190, 0x9f16c693af437,
+	0xa407f79215ade, 0xb2f7189283f79,
+	0xd22595916070c, 0xc4d57a91f62ab,
+	0xffc44b904cc42, 0xe934a490da9e5,
+	0x40174dc3ed9c5, 0x56e7a2c37bc62,
+	0x6df693c2c128b, 0x7b067cc25772c,
+	0x1bd4f1c1b4f59, 0x0d241ec122afe,
+	0x36352fc098417, 0x20c5c0c00e1b0,
+	0xf79035c75f4fd, 0xe160dac7c915a,
+	0xda71ebc673fb3, 0xcc8104c6e5a14,
+	0xac5389c506261, 0xbaa366c5907c6,
+	0x81b257c42a92f, 0x9742b8c4bcc88,
+	0x6a3ab9f03051e, 0x7cca56f0a60b9,
+	0x47db67f11ce50, 0x512b88f18abf7,
+	0x31f905f269382, 0x2709eaf2ff625,
+	0x1c18dbf3458cc, 0x0ae834f3d3d6b,
+	0xddbdc1f482826, 0xcb4d2ef414d81,
+	0xf05c1ff5ae368, 0xe6acf0f5386cf,
+	0x867e7df6dbeba, 0x908e92f64db1d,
+	0xab9fa3f7f75f4, 0xbd6f4cf761053,
+	0xbcfb756b2131f, 0xaa0b9a6bb76b8,
+	0x911aab6a0d851, 0x87ea446a9bdf6,
+	0xe738c96978583, 0xf1c82669ee024,
+	0xcad9176854ecd, 0xdc29f868c2b6a,
+	0x0b7c0d6f93e27, 0x1d8ce26f05b80,
+	0x269dd36ebf569, 0x306d3c6e290ce,
+	0x50bfb16dca8bb, 0x464f5e6d5cd1c,
+	0x7d5e6f6ce63f5, 0x6bae806c70652,
+	0x96d68158fcfc4, 0x80266e586aa63,
+	0xbb375f59d048a, 0xadc7b0594612d,
+	0xcd153d5aa5958, 0xdbe5d25a33cff,
+	0xe0f4e35b89216, 0xf6040c5b1f7b1,
+	0x2151f95c4e2fc, 0x37a1165cd875b,
+	0x0cb0275d629b2, 0x1a40c85df4c15,
+	0x7a92455e17460, 0x6c62aa5e811c7,
+	0x57739b5f3bf2e, 0x4183745fada89,
+	0xe8a09d0c9aaa9, 0xfe50720c0cf0e,
+	0xc541430db61e7, 0xd3b1ac0d20440,
+	0xb363210ec3c35, 0xa593ce0e55992,
+	0x9e82ff0fef77b, 0x8872100f792dc,
+	0x5f27e50828791, 0x49d70a08be236,
+	0x72c63b0904cdf, 0x6436d40992978,
+	0x04e4590a7110d, 0x1214b60ae74aa,
+	0x2905870b5da43, 0x3ff5680bcbfe4,
+	0xc28d693f47672, 0xd47d863fd13d5,
+	0xef6cb73e6bd3c, 0xf99c583efd89b,
+	0x994ed53d1e0ee, 0x8fbe3a3d88549,
+	0xb4af0b3c32ba0, 0xa25fe43ca4e07,
+	0x750a113bf5b4a, 0x63fafe3b63eed,
+	0x58ebcf3ad9004, 0x4e1b203a4f5a3,
+	0x2ec9ad39acdd6, 0x383942393a871,
+	0x0328733880698, 0x15d89c381633f,
+};
+#endif
+
+const struct bch_def bch_4bit = {
+	.syns		= 8,
+	.generator	= { 0x14523043ab86ab },
+	.degree		= 52,
+	.ecc_bytes	= 7,
+	.table		= BCH_TABLE(bch_4bit_table),
+	.fold		= { 0xbf24618665295000, 0x01a920a4d262d000,
+			    0xf9510b03966cf000, 0x17e9f950d392f000 }
+};
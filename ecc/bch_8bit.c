@@ -0,0 +1,294 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include "bch.h"
+
+/* 8-bit ECC over GF(2^13). Each code has its own file, so that only
+ * the tables for codes in use are linked.
+ */
+
+#ifndef BCH_NO_TABLES
+/* Byte-wise remainder table, generated with tools/gentab from the
+ * generator polynomial (shifted right by one bit).
+ */
+static const bch_poly_t bch_8bit_table[256 * 2] = {
+	0x0000000000000000, 0x0000000000000000,
+	0xca813f0aa65a0842, 0x0000005be7f3bfbb,
+	0x95027e154cb41084, 0x000000b7cfe77f77,
+	0x5f83411feaee18c6, 0x000000ec2814c0cc,
+	0x26177b6b5cacda2b, 0x0000007a66da1e94,
+	0xec964461faf6d269, 0x000000218129a12f,
+	0xb315057e1018caaf, 0x000000cda93d61e3,
+	0x79943a74b642c2ed, 0x000000964ecede58,
+	0x4c2ef6d6b959b456, 0x000000f4cdb43d28,
+	0x86afc9dc1f03bc14, 0x000000af2a478293,
+	0xd92c88c3f5eda4d2, 0x000000430253425f,
+	0x13adb7c953b7ac90, 0x00000018e5a0fde4,
+	0x6a398dbde5f56e7d, 0x0000008eab6e23bc,
+	0xa0b8b2b743af663f, 0x000000d54c9d9c07,
+	0xff3bf3a8a9417ef9, 0x0000003964895ccb,
+	0x35bacca20f1b76bb, 0x00000062837ae370,
+	0x944e6aecb777938f, 0x000000fc627c9a2b,
+	0x5ecf55e6112d9bcd, 0x000000a7858f2590,
+	0x014c14f9fbc3830b, 0x0000004bad9be55c,
+	0xcbcd2bf35d998b49, 0x000000104a685ae7,
+	0xb2591187ebdb49a4, 0x0000008604a684bf,
+	0x78d82e8d4d8141e6, 0x000000dde3553b04,
+	0x275b6f92a76f5920, 0x00000031cb41fbc8,
+	0xedda509801355162, 0x0000006a2cb24473,
+	0xd8609c3a0e2e27d9, 0x00000008afc8a703,
+	0x12e1a330a8742f9b, 0x00000053483b18b8,
+	0x4d62e22f429a375d, 0x000000bf602fd874,
+	0x87e3dd25e4c03f1f, 0x000000e487dc67cf,
+	0xfe77e7515282fdf2, 0x00000072c912b997,
+	0x34f6d85bf4d8f5b0, 0x000000292ee1062c,
+	0x6b7599441e36ed76, 0x000000c506f5c6e0,
+	0xa1f4a64eb86ce534, 0x0000009ee106795b,
+	0x248f5298ab2bdc3d, 0x000000ed3dedd42c,
+	0xee0e6d920d71d47f, 0x000000b6da1e6b97,
+	0xb18d2c8de79fccb9, 0x0000005af20aab5b,
+	0x7b0c138741c5c4fb, 0x0000000115f914e0,
+	0x029829f3f7870616, 0x000000975b37cab8,
+	0xc81916f951dd0e54, 0x000000ccbcc47503,
+	0x979a57e6bb331692, 0x0000002094d0b5cf,
+	0x5d1b68ec1d691ed0, 0x0000007b73230a74,
+	0x68a1a44e1272686b, 0x00000019f059e904,
+	0xa2209b44b4286029, 0x0000004217aa56bf,
+	0xfda3da5b5ec678ef, 0x000000ae3fbe9673,
+	0x3722e551f89c70ad, 0x000000f5d84d29c8,
+	0x4eb6df254edeb240, 0x000000639683f790,
+	0x8437e02fe884ba02, 0x000000387170482b,
+	0xdbb4a130026aa2c4, 0x000000d4596488e7,
+	0x11359e3aa430aa86, 0x0000008fbe97375c,
+	0xb0c138741c5c4fb2, 0x000000115f914e07,
+	0x7a40077eba0647f0, 0x0000004ab862f1bc,
+	0x25c3466150e85f36, 0x000000a690763170,
+	0xef42796bf6b25774, 0x000000fd77858ecb,
+	0x96d6431f40f09599, 0x0000006b394b5093,
+	0x5c577c15e6aa9ddb, 0x00000030deb8ef28,
+	0x03d43d0a0c44851d, 0x000000dcf6ac2fe4,
+	0xc9550200aa1e8d5f, 0x00000087115f905f,
+	0xfcefcea2a505fbe4, 0x000000e59225732f,
+	0x366ef1a8035ff3a6, 0x000000be75d6cc94,
+	0x69edb0b7e9b1eb60, 0x000000525dc20c58,
+	0xa36c8fbd4febe322, 0x00000009ba31b3e3,
+	0xdaf8b5c9f9a921cf, 0x0000009ff4ff6dbb,
+	0x10798ac35ff3298d, 0x000000c4130cd200,
+	0x4ffacbdcb51d314b, 0x000000283b1812cc,
+	0x857bf4d613473909, 0x00000073dcebad77,
+	0x450d227093934359, 0x000000cf82cf4823,
+	0x8f8c1d7a35c94b1b, 0x00000094653cf798,
+	0xd00f5c65df2753dd, 0x000000784d283754,
+	0x1a8e636f797d5b9f, 0x00000023aadb88ef,
+	0x631a591bcf3f9972, 0x000000b5e41556b7,
+	0xa99b661169659130, 0x000000ee03e6e90c,
+	0xf618270e838b89f6, 0x000000022bf229c0,
+	0x3c99180425d181b4, 0x00000059cc01967b,
+	0x0923d4a62acaf70f, 0x0000003b4f7b750b,
+	0xc3a2ebac8c90ff4d, 0x00000060a888cab0,
+	0x9c21aab3667ee78b, 0x0000008c809c0a7c,
+	0x56a095b9c024efc9, 0x000000d7676fb5c7,
+	0x2f34afcd76662d24, 0x0000004129a16b9f,
+	0xe5b590c7d03c2566, 0x0000001ace52d424,
+	0xba36d1d83ad23da0, 0x000000f6e64614e8,
+	0x70b7eed29c8835e2, 0x000000ad01b5ab53,
+	0xd143489c24e4d0d6, 0x00000033e0b3d208,
+	0x1bc2779682bed894, 0x0000006807406db3,
+	0x444136896850c052, 0x000000842f54ad7f,
+	0x8ec00983ce0ac810, 0x000000dfc8a712c4,
+	0xf75433f778480afd, 0x000000498669cc9c,
+	0x3dd50cfdde1202bf, 0x00000012619a7327,
+	0x62564de234fc1a79, 0x000000fe498eb3eb,
+	0xa8d772e892a6123b, 0x000000a5ae7d0c50,
+	0x9d6dbe4a9dbd6480, 0x000000c72d07ef20,
+	0x57ec81403be76cc2, 0x0000009ccaf4509b,
+	0x086fc05fd1097404, 0x00000070e2e09057,
+	0xc2eeff5577537c46, 0x0000002b05132fec,
+	0xbb7ac521c111beab, 0x000000bd4bddf1b4,
+	0x71fbfa2b674bb6e9, 0x000000e6ac2e4e0f,
+	0x2e78bb348da5ae2f, 0x0000000a843a8ec3,
+	0xe4f9843e2bffa66d, 0x0000005163c93178,
+	0x618270e838b89f64, 0x00000022bf229c0f,
+	0xab034fe29ee29726, 0x0000007958d123b4,
+	0xf4800efd740c8fe0, 0x0000009570c5e378,
+	0x3e0131f7d25687a2, 0x000000ce97365cc3,
+	0x47950b836414454f, 0x00000058d9f8829b,
+	0x8d143489c24e4d0d, 0x000000033e0b3d20,
+	0xd297759628a055cb, 0x000000ef161ffdec,
+	0x18164a9c8efa5d89, 0x000000b4f1ec4257,
+	0x2dac863e81e12b32, 0x000000d67296a127,
+	0xe72db93427bb2370, 0x0000008d95651e9c,
+	0xb8aef82bcd553bb6, 0x00000061bd71de50,
+	0x722fc7216b0f33f4, 0x0000003a5a8261eb,
+	0x0bbbfd55dd4df119, 0x000000ac144cbfb3,
+	0xc13ac25f7b17f95b, 0x000000f7f3bf0008,
+	0x9eb9834091f9e19d, 0x0000001bdbabc0c4,
+	0x5438bc4a37a3e9df, 0x000000403c587f7f,
+	0xf5cc1a048fcf0ceb, 0x000000dedd5e0624,
+	0x3f4d250e299504a9, 0x000000853aadb99f,
+	0x60ce6411c37b1c6f, 0x0000006912b97953,
+	0xaa4f5b1b6521142d, 0x00000032f54ac6e8,
+	0xd3db616fd363d6c0, 0x000000a4bb8418b0,
+	0x195a5e657539de82, 0x000000ff5c77a70b,
+	0x46d91f7a9fd7c644, 0x00000013746367c7,
+	0x8c582070398dce06, 0x000000489390d87c,
+	0xb9e2ecd23696b8bd, 0x0000002a10ea3b0c,
+	0x7363d3d890ccb0ff, 0x00000071f71984b7,
+	0x2ce092c77a22a839, 0x0000009ddf0d447b,
+	0xe661adcddc78a07b, 0x000000c638fefbc0,
+	0x9ff597b96a3a6296, 0x0000005076302598,
+	0x5574a8b3cc606ad4, 0x0000000b91c39a23,
+	0x0af7e9ac268e7212, 0x000000e7b9d75aef,
+	0xc076d6a680d47a50, 0x000000bc5e24e554,
+	0x8609c3a0e2e27d91, 0x0000008afc8a703d,
+	0x4c88fcaa44b875d3, 0x000000d11b79cf86,
+	0x130bbdb5ae566d15, 0x0000003d336d0f4a,
+	0xd98a82bf080c6557, 0x00000066d49eb0f1,
+	0xa01eb8cbbe4ea7ba, 0x000000f09a506ea9,
+	0x6a9f87c11814aff8, 0x000000ab7da3d112,
+	0x351cc6def2fab73e, 0x0000004755b711de,
+	0xff9df9d454a0bf7c, 0x0000001cb244ae65,
+	0xca2735765bbbc9c7, 0x0000007e313e4d15,
+	0x00a60a7cfde1c185, 0x00000025d6cdf2ae,
+	0x5f254b63170fd943, 0x000000c9fed93262,
+	0x95a47469b155d101, 0x00000092192a8dd9,
+	0xec304e1d071713ec, 0x0000000457e45381,
+	0x26b17117a14d1bae, 0x0000005fb017ec3a,
+	0x793230084ba30368, 0x000000b398032cf6,
+	0xb3b30f02edf90b2a, 0x000000e87ff0934d,
+	0x1247a94c5595ee1e, 0x000000769ef6ea16,
+	0xd8c69646f3cfe65c, 0x0000002d790555ad,
+	0x8745d7591921fe9a, 0x000000c151119561,
+	0x4dc4e853bf7bf6d8, 0x0000009ab6e22ada,
+	0x3450d22709393435, 0x0000000cf82cf482,
+	0xfed1ed2daf633c77, 0x000000571fdf4b39,
+	0xa152ac32458d24b1, 0x000000bb37cb8bf5,
+	0x6bd39338e3d72cf3, 0x000000e0d038344e,
+	0x5e695f9aeccc5a48, 0x000000825342d73e,
+	0x94e860904a96520a, 0x000000d9b4b16885,
+	0xcb6b218fa0784acc, 0x000000359ca5a849,
+	0x01ea1e850622428e, 0x0000006e7b5617f2,
+	0x787e24f1b0608063, 0x000000f83598c9aa,
+	0xb2ff1bfb163a8821, 0x000000a3d26b7611,
+	0xed7c5ae4fcd490e7, 0x0000004ffa7fb6dd,
+	0x27fd65ee5a8e98a5, 0x000000141d8c0966,
+	0xa286913849c9a1ac, 0x00000067c167a411,
+	0x6807ae32ef93a9ee, 0x0000003c26941baa,
+	0x3784ef2d057db128, 0x000000d00e80db66,
+	0xfd05d027a327b96a, 0x0000008be97364dd,
+	0x8491ea5315657b87, 0x0000001da7bdba85,
+	0x4e10d559b33f73c5, 0x00000046404e053e,
+	0x1193944659d16b03, 0x000000aa685ac5f2,
+	0xdb12ab4cff8b6341, 0x000000f18fa97a49,
+	0xeea867eef09015fa, 0x000000930cd39939,
+	0x242958e456ca1db8, 0x000000c8eb202682,
+	0x7baa19fbbc24057e, 0x00000024c334e64e,
+	0xb12b26f11a7e0d3c, 0x0000007f24c759f5,
+	0xc8bf1c85ac3ccfd1, 0x000000e96a0987ad,
+	0x023e238f0a66c793, 0x000000b28dfa3816,
+	0x5dbd6290e088df55, 0x0000005ea5eef8da,
+	0x973c5d9a46d2d717, 0x00000005421d4761,
+	0x36c8fbd4febe3223, 0x0000009ba31b3e3a,
+	0xfc49c4de58e43a61, 0x000000c044e88181,
+	0xa3ca85c1b20a22a7, 0x0000002c6cfc414d,
+	0x694bbacb14502ae5, 0x000000778b0ffef6,
+	0x10df80bfa212e808, 0x000000e1c5c120ae,
+	0xda5ebfb50448e04a, 0x000000ba22329f15,
+	0x85ddfeaaeea6f88c, 0x000000560a265fd9,
+	0x4f5cc1a048fcf0ce, 0x0000000dedd5e062,
+	0x7ae60d0247e78675, 0x0000006f6eaf0312,
+	0xb0673208e1bd8e37, 0x00000034895cbca9,
+	0xefe473170b5396f1, 0x000000d8a1487c65,
+	0x25654c1dad099eb3, 0x0000008346bbc3de,
+	0x5cf176691b4b5c5e, 0x0000001508751d86,
+	0x96704963bd11541c, 0x0000004eef86a23d,
+	0xc9f3087c57ff4cda, 0x000000a2c79262f1,
+	0x03723776f1a54498, 0x000000f92061dd4a,
+	0xc304e1d071713ec8, 0x000000457e45381e,
+	0x0985dedad72b368a, 0x0000001e99b687a5,
+	0x56069fc53dc52e4c, 0x000000f2b1a24769,
+	0x9c87a0cf9b9f260e, 0x000000a95651f8d2,
+	0xe5139abb2ddde4e3, 0x0000003f189f268a,
+	0x2f92a5b18b87eca1, 0x00000064ff6c9931,
+	0x7011e4ae6169f467, 0x00000088d77859fd,
+	0xba90dba4c733fc25, 0x000000d3308be646,
+	0x8f2a1706c8288a9e, 0x000000b1b3f10536,
+	0x45ab280c6e7282dc, 0x000000ea5402ba8d,
+	0x1a286913849c9a1a, 0x000000067c167a41,
+	0xd0a9561922c69258, 0x0000005d9be5c5fa,
+	0xa93d6c6d948450b5, 0x000000cbd52b1ba2,
+	0x63bc536732de58f7, 0x0000009032d8a419,
+	0x3c3f1278d8304031, 0x0000007c1acc64d5,
+	0xf6be2d727e6a4873, 0x00000027fd3fdb6e,
+	0x574a8b3cc606ad47, 0x000000b91c39a235,
+	0x9dcbb436605ca505, 0x000000e2fbca1d8e,
+	0xc248f5298ab2bdc3, 0x0000000ed3dedd42,
+	0x08c9ca232ce8b581, 0x00000055342d62f9,
+	0x715df0579aaa776c, 0x000000c37ae3bca1,
+	0xbbdccf5d3cf07f2e, 0x000000989d10031a,
+	0xe45f8e42d61e67e8, 0x00000074b504c3d6,
+	0x2edeb14870446faa, 0x0000002f52f77c6d,
+	0x1b647dea7f5f1911, 0x0000004dd18d9f1d,
+	0xd1e542e0d9051153, 0x00000016367e20a6,
+	0x8e6603ff33eb0995, 0x000000fa1e6ae06a,
+	0x44e73cf595b101d7, 0x000000a1f9995fd1,
+	0x3d73068123f3c33a, 0x00000037b7578189,
+	0xf7f2398b85a9cb78, 0x0000006c50a43e32,
+	0xa87178946f47d3be, 0x0000008078b0fefe,
+	0x62f0479ec91ddbfc, 0x000000db9f434145,
+	0xe78bb348da5ae2f5, 0x000000a843a8ec32,
+	0x2d0a8c427c00eab7, 0x000000f3a45b5389,
+	0x7289cd5d96eef271, 0x0000001f8c4f9345,
+	0xb808f25730b4fa33, 0x000000446bbc2cfe,
+	0xc19cc82386f638de, 0x000000d22572f2a6,
+	0x0b1df72920ac309c, 0x00000089c2814d1d,
+	0x549eb636ca42285a, 0x00000065ea958dd1,
+	0x9e1f893c6c182018, 0x0000003e0d66326a,
+	0xaba5459e630356a3, 0x0000005c8e1cd11a,
+	0x61247a94c5595ee1, 0x0000000769ef6ea1,
+	0x3ea73b8b2fb74627, 0x000000eb41fbae6d,
+	0xf426048189ed4e65, 0x000000b0a60811d6,
+	0x8db23ef53faf8c88, 0x00000026e8c6cf8e,
+	0x473301ff99f584ca, 0x0000007d0f357035,
+	0x18b040e0731b9c0c, 0x000000912721b0f9,
+	0xd2317fead541944e, 0x000000cac0d20f42,
+	0x73c5d9a46d2d717a, 0x0000005421d47619,
+	0xb944e6aecb777938, 0x0000000fc627c9a2,
+	0xe6c7a7b1219961fe, 0x000000e3ee33096e,
+	0x2c4698bb87c369bc, 0x000000b809c0b6d5,
+	0x55d2a2cf3181ab51, 0x0000002e470e688d,
+	0x9f539dc597dba313, 0x00000075a0fdd736,
+	0xc0d0dcda7d35bbd5, 0x0000009988e917fa,
+	0x0a51e3d0db6fb397, 0x000000c26f1aa841,
+	0x3feb2f72d474c52c, 0x000000a0ec604b31,
+	0xf56a1078722ecd6e, 0x000000fb0b93f48a,
+	0xaae9516798c0d5a8, 0x0000001723873446,
+	0x60686e6d3e9addea, 0x0000004cc4748bfd,
+	0x19fc541988d81f07, 0x000000da8aba55a5,
+	0xd37d6b132e821745, 0x000000816d49ea1e,
+	0x8cfe2a0cc46c0f83, 0x0000006d455d2ad2,
+	0x467f1506623607c1, 0x00000036a2ae9569,
+};
+#endif
+
+const struct bch_def bch_8bit = {
+	.syns		= 16,
+	.generator	= { 0xc138741c5c4fb23, 0x115f914e07b },
+	.degree		= 104,
+	.ecc_bytes	= 13,
+	.table		= BCH_TABLE(bch_8bit_table)
+};
@@ -0,0 +1,93 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include "clmul.h"
+
+#if !defined(ECC_NO_CLMUL) && defined(__x86_64__) && defined(__GNUC__)
+#define CLMUL_X86
+#include <wmmintrin.h>
+#endif
+
+#ifdef CLMUL_X86
+#define X86_TARGET	__attribute__((target("sse2,pclmul")))
+
+X86_TARGET
+static inline __m128i load_inv(const uint8_t *p)
+{
+	return _mm_xor_si128(_mm_loadu_si128((const __m128i *)p),
+			     _mm_set1_epi32(-1));
+}
+
+/* Given an accumulator a = a_hi*x^64 + a_lo (a_hi held in the low
+ * quadword, since the representation is reflected), compute
+ * a*x^n + b, with k holding x^(n+63) and x^(n-1).
+ *
+ * Products of reflected operands come out one bit short of the
+ * accumulator's representation, which is why the constants are one
+ * power of x lower than might be expected.
+ */
+X86_TARGET
+static inline __m128i fold(__m128i a, __m128i k, __m128i b)
+{
+	return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(a, k, 0x00),
+					   _mm_clmulepi64_si128(a, k, 0x11)),
+			     b);
+}
+
+X86_TARGET
+static size_t fold_x86(const uint64_t *k, const uint8_t *block, size_t len,
+		       uint64_t seed, uint8_t *acc)
+{
+	const __m128i k4 = _mm_set_epi64x(k[1], k[0]);
+	const __m128i k1 = _mm_set_epi64x(k[3], k[2]);
+	__m128i a0 = _mm_xor_si128(load_inv(block), _mm_cvtsi64_si128(seed));
+	__m128i a1 = load_inv(block + 16);
+	__m128i a2 = load_inv(block + 32);
+	__m128i a3 = load_inv(block + 48);
+	size_t i;
+
+	/* Four lanes, 64 bytes at a time */
+	for (i = 64; i + 64 <= len; i += 64) {
+		a0 = fold(a0, k4, load_inv(block + i));
+		a1 = fold(a1, k4, load_inv(block + i + 16));
+		a2 = fold(a2, k4, load_inv(block + i + 32));
+		a3 = fold(a3, k4, load_inv(block + i + 48));
+	}
+
+	/* Merge the lanes, and then fold what's left 16 bytes at a time */
+	a0 = fold(a0, k1, a1);
+	a0 = fold(a0, k1, a2);
+	a0 = fold(a0, k1, a3);
+
+	for (; i + 16 <= len; i += 16)
+		a0 = fold(a0, k1, load_inv(block + i));
+
+	_mm_storeu_si128((__m128i *)acc,
+			 _mm_xor_si128(a0, _mm_set1_epi32(-1)));
+	return i;
+}
+#endif
+
+size_t clmul_fold(const uint64_t *k, const uint8_t *block, size_t len,
+		  uint64_t seed, uint8_t *acc)
+{
+#ifdef CLMUL_X86
+	if ((len >= 64) && __builtin_cpu_supports("pclmul"))
+		return fold_x86(k, block, len, seed, acc);
+#endif
+	return 0;
+}
@@ -0,0 +1,52 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#ifndef ECC_CLMUL_H_
+#define ECC_CLMUL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* Carry-less multiply folding for reflected CRCs, and for BCH
+ * remainders over generators of degree 64 or less.
+ *
+ * The block is inverted (both crc32_nand() and the BCH codes treat
+ * coefficients as inverted) and folded, 16 bytes at a time, into a
+ * 128-bit accumulator which is congruent to it modulo the generator.
+ * The seed is XORed into the first 8 bytes after inversion. This is how
+ * a CRC carry is introduced.
+ *
+ * The accumulator is inverted again and written to acc. Running the
+ * byte-wise algorithm from its initial state over acc, and then over
+ * the bytes not consumed, gives the same result as running it over the
+ * whole block.
+ *
+ * The constants are x^575, x^511, x^191 and x^127 modulo the generator,
+ * in reflected form widened to 64 bits (LSB -> x^63). They can be
+ * produced by tools/gentab.
+ *
+ * The return value is the number of bytes consumed. This is 0 if the
+ * host doesn't support carry-less multiplication, or if the block is
+ * too short to be worth folding. Define ECC_NO_CLMUL to leave out the
+ * kernels entirely.
+ */
+#define CLMUL_FOLD_CONSTS	4
+
+size_t clmul_fold(const uint64_t *k, const uint8_t *block, size_t len,
+		  uint64_t seed, uint8_t *acc);
+
+#endif
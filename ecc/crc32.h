@@ -43,4 +43,12 @@
 uint32_t crc32_nand(const uint8_t *block, size_t len,
 		    uint32_t carry);
 
+/* Given the checksum of a block A (calculated with any carry), and the
+ * checksum of a block B of len_b bytes (calculated with CRC32_INIT),
+ * find the checksum of A followed by B. This allows parts of a buffer
+ * to be checksummed independently (for example, in parallel) and
+ * merged afterwards.
+ */
+uint32_t crc32_nand_combine(uint32_t crc_a, uint32_t crc_b, size_t len_b);
+
 #endif
@@ -16,7 +16,114 @@
 
 #include "gf13.h"
 
-#ifdef GF13_NO_TABLES
+#if defined(GF13_SMALL_TABLES) && !defined(GF13_NO_TABLES)
+
+/* Reduction of bits 13-18 and 19-24 of a product (of degree up to 24)
+ * modulo the field polynomial.
+ */
+static const uint16_t reduce_lo[64] = {
+	0x0000, 0x001b, 0x0036, 0x002d, 0x006c, 0x0077, 0x005a, 0x0041,
+	0x00d8, 0x00c3, 0x00ee, 0x00f5, 0x00b4, 0x00af, 0x0082, 0x0099,
+	0x01b0, 0x01ab, 0x0186, 0x019d, 0x01dc, 0x01c7, 0x01ea, 0x01f1,
+	0x0168, 0x0173, 0x015e, 0x0145, 0x0104, 0x011f, 0x0132, 0x0129,
+	0x0360, 0x037b, 0x0356, 0x034d, 0x030c, 0x0317, 0x033a, 0x0321,
+	0x03b8, 0x03a3, 0x038e, 0x0395, 0x03d4, 0x03cf, 0x03e2, 0x03f9,
+	0x02d0, 0x02cb, 0x02e6, 0x02fd, 0x02bc, 0x02a7, 0x028a, 0x0291,
+	0x0208, 0x0213, 0x023e, 0x0225, 0x0264, 0x027f, 0x0252, 0x0249,
+};
+
+static const uint16_t reduce_hi[64] = {
+	0x0000, 0x06c0, 0x0d80, 0x0b40, 0x1b00, 0x1dc0, 0x1680, 0x1040,
+	0x161b, 0x10db, 0x1b9b, 0x1d5b, 0x0d1b, 0x0bdb, 0x009b, 0x065b,
+	0x0c2d, 0x0aed, 0x01ad, 0x076d, 0x172d, 0x11ed, 0x1aad, 0x1c6d,
+	0x1a36, 0x1cf6, 0x17b6, 0x1176, 0x0136, 0x07f6, 0x0cb6, 0x0a76,
+	0x185a, 0x1e9a, 0x15da, 0x131a, 0x035a, 0x059a, 0x0eda, 0x081a,
+	0x0e41, 0x0881, 0x03c1, 0x0501, 0x1541, 0x1381, 0x18c1, 0x1e01,
+	0x1477, 0x12b7, 0x19f7, 0x1f37, 0x0f77, 0x09b7, 0x02f7, 0x0437,
+	0x026c, 0x04ac, 0x0fec, 0x092c, 0x196c, 0x1fac, 0x14ec, 0x122c,
+};
+
+/* Nibbles with their bits spread to even positions, for squaring */
+static const uint8_t spread[16] = {
+	0x00, 0x01, 0x04, 0x05, 0x10, 0x11, 0x14, 0x15,
+	0x40, 0x41, 0x44, 0x45, 0x50, 0x51, 0x54, 0x55
+};
+
+/* Squares of bits 7-12, reduced */
+static const uint16_t square_hi[64] = {
+	0x0000, 0x0036, 0x00d8, 0x00ee, 0x0360, 0x0356, 0x03b8, 0x038e,
+	0x0d80, 0x0db6, 0x0d58, 0x0d6e, 0x0ee0, 0x0ed6, 0x0e38, 0x0e0e,
+	0x161b, 0x162d, 0x16c3, 0x16f5, 0x157b, 0x154d, 0x15a3, 0x1595,
+	0x1b9b, 0x1bad, 0x1b43, 0x1b75, 0x18fb, 0x18cd, 0x1823, 0x1815,
+	0x185a, 0x186c, 0x1882, 0x18b4, 0x1b3a, 0x1b0c, 0x1be2, 0x1bd4,
+	0x15da, 0x15ec, 0x1502, 0x1534, 0x16ba, 0x168c, 0x1662, 0x1654,
+	0x0e41, 0x0e77, 0x0e99, 0x0eaf, 0x0d21, 0x0d17, 0x0df9, 0x0dcf,
+	0x03c1, 0x03f7, 0x0319, 0x032f, 0x00a1, 0x0097, 0x0079, 0x004f,
+};
+
+static inline gf13_elem_t reduce(uint32_t p)
+{
+	return (p & 0x1fff) ^ reduce_lo[(p >> 13) & 0x3f] ^
+		reduce_hi[p >> 19];
+}
+
+gf13_elem_t gf13_mul(gf13_elem_t a, gf13_elem_t b)
+{
+	uint16_t w[16];
+	uint32_t p;
+	int i;
+
+	/* Multiples of a by each polynomial of degree < 4 */
+	w[0] = 0;
+	w[1] = a;
+	for (i = 2; i < 16; i += 2) {
+		w[i] = w[i >> 1] << 1;
+		w[i + 1] = w[i] ^ a;
+	}
+
+	p = w[b >> 12];
+	p = (p << 4) ^ w[(b >> 8) & 0xf];
+	p = (p << 4) ^ w[(b >> 4) & 0xf];
+	p = (p << 4) ^ w[b & 0xf];
+
+	return reduce(p);
+}
+
+/* Squaring is linear, and amounts to spreading the bits out. Bits 0-6
+ * land below x^13 and need no reduction.
+ */
+static inline gf13_elem_t square(gf13_elem_t a)
+{
+	return (spread[a & 0xf] | (spread[(a >> 4) & 0x7] << 8)) ^
+		square_hi[a >> 7];
+}
+
+static gf13_elem_t square_n(gf13_elem_t a, int n)
+{
+	while (n--)
+		a = square(a);
+
+	return a;
+}
+
+gf13_elem_t gf13_div(gf13_elem_t a, gf13_elem_t b)
+{
+	gf13_elem_t b2, b3, b6, b12;
+
+	/* The inverse of b is b^(2^13 - 2). Build up b^(2^k - 1) for
+	 * k = 2, 3, 6, 12 using b^(2^(j + k) - 1) =
+	 * (b^(2^j - 1))^(2^k) * b^(2^k - 1) (Itoh and Tsujii), and then
+	 * square.
+	 */
+	b2 = gf13_mul(square(b), b);
+	b3 = gf13_mul(square(b2), b);
+	b6 = gf13_mul(square_n(b3, 3), b3);
+	b12 = gf13_mul(square_n(b6, 6), b6);
+
+	return gf13_mul(a, square(b12));
+}
+
+#elif defined(GF13_NO_TABLES)
 
 gf13_elem_t gf13_mul(gf13_elem_t a, gf13_elem_t b)
 {
@@ -27,16 +27,24 @@ typedef uint16_t	gf13_elem_t;
 /* If you need to reduce the code size, you can define GF13_NO_TABLES.
  *
  * This results in much smaller (but also much slower) code.
+ *
+ * GF13_SMALL_TABLES is a middle option: multiplication uses a windowed
+ * carry-less multiply with small reduction tables (under 450 bytes),
+ * and division an inversion by squaring. See tools/gfbench for
+ * measurements of each option.
  */
 
-#ifdef GF13_NO_TABLES
+#if defined(GF13_NO_TABLES) || defined(GF13_SMALL_TABLES)
 
 gf13_elem_t gf13_mul(gf13_elem_t a, gf13_elem_t b);
 gf13_elem_t gf13_div(gf13_elem_t a, gf13_elem_t b);
 
 static inline gf13_elem_t gf13_divx(gf13_elem_t a)
 {
-	return gf13_mul(a, 0x100d);
+	if (a & 1)
+		a ^= 0x201b;
+
+	return a >> 1;
 }
 
 static inline gf13_elem_t gf13_mulx(gf13_elem_t a)
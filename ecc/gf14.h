@@ -0,0 +1,85 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef ECC_GF14_H_
+#define ECC_GF14_H_
+
+#include <stdint.h>
+
+/* Galois field tables of order 2^14-1 */
+#define GF14_ORDER	16383
+
+typedef uint16_t	gf14_elem_t;
+
+/* If you need to reduce the code size, you can define GF14_NO_TABLES.
+ *
+ * This results in much smaller (but also much slower) code.
+ */
+
+#ifdef GF14_NO_TABLES
+
+gf14_elem_t gf14_mul(gf14_elem_t a, gf14_elem_t b);
+gf14_elem_t gf14_div(gf14_elem_t a, gf14_elem_t b);
+
+static inline gf14_elem_t gf14_divx(gf14_elem_t a)
+{
+	return gf14_mul(a, 0x2015);
+}
+
+static inline gf14_elem_t gf14_mulx(gf14_elem_t a)
+{
+	gf14_elem_t r = a << 1;
+
+	if (r & 16384)
+		r ^= 0x402b;
+
+	return r;
+}
+
+#else
+
+extern const gf14_elem_t gf14_exp[16384];
+extern const gf14_elem_t gf14_log[16384];
+
+/* Wrappers for field arithmetic */
+static inline gf14_elem_t gf14_wrap(gf14_elem_t s)
+{
+	return (s >= GF14_ORDER) ? (s - GF14_ORDER) : s;
+}
+
+static inline gf14_elem_t gf14_mul(gf14_elem_t a, gf14_elem_t b)
+{
+	return gf14_exp[gf14_wrap(gf14_log[a] + gf14_log[b])];
+}
+
+static inline gf14_elem_t gf14_div(gf14_elem_t a, gf14_elem_t b)
+{
+	return gf14_exp[gf14_wrap(gf14_log[a] + GF14_ORDER - gf14_log[b])];
+}
+
+static inline gf14_elem_t gf14_divx(gf14_elem_t a)
+{
+	return gf14_exp[gf14_wrap(gf14_log[a] + GF14_ORDER - 1)];
+}
+
+static inline gf14_elem_t gf14_mulx(gf14_elem_t a)
+{
+	return gf14_exp[gf14_wrap(gf14_log[a] + 1)];
+}
+
+#endif
+
+#endif
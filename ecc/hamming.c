@@ -17,48 +17,24 @@
 #include "hamming.h"
 
 #define HAMMING_LOG2_CHUNK_SIZE		9
-#define HAMMING_LOG2_CHUNK_BITS		(HAMMING_LOG2_CHUNK_SIZE + 3)
-
-static const uint8_t bit_count[] = {
-	0x00, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x03,
-	0x01, 0x02, 0x02, 0x03, 0x02, 0x03, 0x03, 0x04,
-	0x01, 0x02, 0x02, 0x03, 0x02, 0x03, 0x03, 0x04,
-	0x02, 0x03, 0x03, 0x04, 0x03, 0x04, 0x04, 0x05,
-	0x01, 0x02, 0x02, 0x03, 0x02, 0x03, 0x03, 0x04,
-	0x02, 0x03, 0x03, 0x04, 0x03, 0x04, 0x04, 0x05,
-	0x02, 0x03, 0x03, 0x04, 0x03, 0x04, 0x04, 0x05,
-	0x03, 0x04, 0x04, 0x05, 0x04, 0x05, 0x05, 0x06,
-	0x01, 0x02, 0x02, 0x03, 0x02, 0x03, 0x03, 0x04,
-	0x02, 0x03, 0x03, 0x04, 0x03, 0x04, 0x04, 0x05,
-	0x02, 0x03, 0x03, 0x04, 0x03, 0x04, 0x04, 0x05,
-	0x03, 0x04, 0x04, 0x05, 0x04, 0x05, 0x05, 0x06,
-	0x02, 0x03, 0x03, 0x04, 0x03, 0x04, 0x04, 0x05,
-	0x03, 0x04, 0x04, 0x05, 0x04, 0x05, 0x05, 0x06,
-	0x03, 0x04, 0x04, 0x05, 0x04, 0x05, 0x05, 0x06,
-	0x04, 0x05, 0x05, 0x06, 0x05, 0x06, 0x06, 0x07,
-	0x01, 0x02, 0x02, 0x03, 0x02, 0x03, 0x03, 0x04,
-	0x02, 0x03, 0x03, 0x04, 0x03, 0x04, 0x04, 0x05,
-	0x02, 0x03, 0x03, 0x04, 0x03, 0x04, 0x04, 0x05,
-	0x03, 0x04, 0x04, 0x05, 0x04, 0x05, 0x05, 0x06,
-	0x02, 0x03, 0x03, 0x04, 0x03, 0x04, 0x04, 0x05,
-	0x03, 0x04, 0x04, 0x05, 0x04, 0x05, 0x05, 0x06,
-	0x03, 0x04, 0x04, 0x05, 0x04, 0x05, 0x05, 0x06,
-	0x04, 0x05, 0x05, 0x06, 0x05, 0x06, 0x06, 0x07,
-	0x02, 0x03, 0x03, 0x04, 0x03, 0x04, 0x04, 0x05,
-	0x03, 0x04, 0x04, 0x05, 0x04, 0x05, 0x05, 0x06,
-	0x03, 0x04, 0x04, 0x05, 0x04, 0x05, 0x05, 0x06,
-	0x04, 0x05, 0x05, 0x06, 0x05, 0x06, 0x06, 0x07,
-	0x03, 0x04, 0x04, 0x05, 0x04, 0x05, 0x05, 0x06,
-	0x04, 0x05, 0x05, 0x06, 0x05, 0x06, 0x06, 0x07,
-	0x04, 0x05, 0x05, 0x06, 0x05, 0x06, 0x06, 0x07,
-	0x05, 0x06, 0x06, 0x07, 0x06, 0x07, 0x07, 0x08
-};
-
-static hamming_ecc_t parity_scan(const uint8_t *chunk, size_t len)
+
+/* Parity of a byte */
+static inline int parity(uint8_t c)
+{
+	c ^= c >> 4;
+	c ^= c >> 2;
+	c ^= c >> 1;
+
+	return c & 1;
+}
+
+static hamming_ecc_t parity_scan(int log2_size,
+				 const uint8_t *chunk, size_t len)
 {
-	uint8_t column = 0;
+	const int ecc_bits = hamming_ecc_size(log2_size) << 3;
+	uint32_t column = 0;
 	uint16_t line = 0;
-	uint16_t line_bar = 0;
+	uint16_t line_bar;
 	hamming_ecc_t out = 0;
 	int i;
 
@@ -78,17 +54,52 @@ static hamming_ecc_t parity_scan(const uint8_t *chunk, size_t len)
 	 * Pm'), then i belongs to Pm if bit m in i is clear. Otherwise,
 	 * it belongs to Pm'.
 	 */
-	for (i = 0; i < len; i++) {
+	for (i = 0; i + 4 <= len; i += 4) {
+		uint32_t w = chunk[i] |
+			(chunk[i + 1] << 8) |
+			(chunk[i + 2] << 16) |
+			((uint32_t)chunk[i + 3] << 24);
+		uint32_t t;
+
+		column ^= w;
+
+		/* Reduce each byte to its parity, in its lowest bit */
+		w ^= w >> 4;
+		w ^= w >> 2;
+		w ^= w >> 1;
+		w &= 0x01010101;
+
+		/* Every odd-parity byte contributes its index to the line
+		 * parity. The low two bits of those indices come from
+		 * bytes 1 and 3, and bytes 2 and 3, respectively. The rest
+		 * is i, if an odd number of the bytes have odd parity.
+		 */
+		t = w ^ (w >> 16);
+		line ^= ((t >> 8) & 1) |
+			(((w >> 15) ^ (w >> 23)) & 2) |
+			(-((t ^ (t >> 8)) & 1) & i);
+	}
+
+	column ^= column >> 16;
+	column ^= column >> 8;
+	column &= 0xff;
+
+	for (; i < len; i++) {
 		const uint8_t c = chunk[i];
 
 		column ^= c;
 
-		if (bit_count[c] & 1) {
+		if (parity(c))
 			line ^= i;
-			line_bar ^= ~i;
-		}
 	}
 
+	/* Each odd-parity byte contributes ~i to the complementary line
+	 * parity. This differs from the line parity in all bits if
+	 * there's an odd number of such bytes, which is the parity of
+	 * the whole chunk.
+	 */
+	line_bar = parity(column) ? ~line : line;
+
 	/* The output checksum is the parity of the sets, in the
 	 * following order:
 	 *
@@ -104,54 +115,57 @@ static hamming_ecc_t parity_scan(const uint8_t *chunk, size_t len)
 	 * By observing which of each pair has changed parity, we can
 	 * determine each bit of i.
 	 */
-	for (i = 0; i < HAMMING_LOG2_CHUNK_SIZE; i++) {
+	for (i = log2_size - 1; i >= 0; i--) {
 		out <<= 1;
-		out |= (line_bar >> 8) & 1;
+		out |= (line_bar >> i) & 1;
 
 		out <<= 1;
-		out |= (line >> 8) & 1;
-
-		line <<= 1;
-		line_bar <<= 1;
+		out |= (line >> i) & 1;
 	}
 
-	out = (out << 1) | (bit_count[column & 0x0f] & 1);
-	out = (out << 1) | (bit_count[column & 0xf0] & 1);
-	out = (out << 1) | (bit_count[column & 0x33] & 1);
-	out = (out << 1) | (bit_count[column & 0xcc] & 1);
-	out = (out << 1) | (bit_count[column & 0x55] & 1);
-	out = (out << 1) | (bit_count[column & 0xaa] & 1);
+	out = (out << 1) | parity(column & 0x0f);
+	out = (out << 1) | parity(column & 0xf0);
+	out = (out << 1) | parity(column & 0x33);
+	out = (out << 1) | parity(column & 0xcc);
+	out = (out << 1) | parity(column & 0x55);
+	out = (out << 1) | parity(column & 0xaa);
 
-	return out ^ 0xffffff;
+	/* Invert all ECC bits, including any unused ones, so that an
+	 * erased chunk has erased ECC.
+	 */
+	return out ^ (((hamming_ecc_t)~0) >> (32 - ecc_bits));
 }
 
-void hamming_generate(const uint8_t *chunk, size_t len, uint8_t *ecc)
+void hamming_generate_ext(int log2_size, const uint8_t *chunk, size_t len,
+			  uint8_t *ecc)
 {
-	hamming_ecc_t p = parity_scan(chunk, len);
+	hamming_ecc_t p = parity_scan(log2_size, chunk, len);
+	const int n = hamming_ecc_size(log2_size);
+	int i;
 
-	ecc[0] = p;
-	p >>= 8;
-	ecc[1] = p;
-	p >>= 8;
-	ecc[2] = p;
+	for (i = 0; i < n; i++) {
+		ecc[i] = p;
+		p >>= 8;
+	}
 }
 
-hamming_ecc_t hamming_syndrome(const uint8_t *chunk, size_t len,
-			       const uint8_t *ecc)
+hamming_ecc_t hamming_syndrome_ext(int log2_size, const uint8_t *chunk,
+				   size_t len, const uint8_t *ecc)
 {
-	const hamming_ecc_t p = parity_scan(chunk, len);
+	const hamming_ecc_t p = parity_scan(log2_size, chunk, len);
 	hamming_ecc_t q = 0;
+	int i;
 
-	q |= ecc[2];
-	q <<= 8;
-	q |= ecc[1];
-	q <<= 8;
-	q |= ecc[0];
+	for (i = hamming_ecc_size(log2_size) - 1; i >= 0; i--) {
+		q <<= 8;
+		q |= ecc[i];
+	}
 
 	return p ^ q;
 }
 
-int hamming_repair(uint8_t *chunk, size_t len, hamming_ecc_t syndrome)
+int hamming_repair_ext(int log2_size, uint8_t *chunk, size_t len,
+		       hamming_ecc_t syndrome)
 {
 	int pos = 0;
 	int pos_bit = 1;
@@ -169,7 +183,7 @@ int hamming_repair(uint8_t *chunk, size_t len, hamming_ecc_t syndrome)
 	 * error in the chunk. If this is true, then exactly one out of
 	 * every complementary pair of syndrome bits should be set.
 	 */
-	for (i = 0; i < HAMMING_LOG2_CHUNK_BITS; i++) {
+	for (i = 0; i < log2_size + 3; i++) {
 		const int s = syndrome & 3;
 
 		if (s == 1)
@@ -187,3 +201,20 @@ int hamming_repair(uint8_t *chunk, size_t len, hamming_ecc_t syndrome)
 
 	return 0;
 }
+
+void hamming_generate(const uint8_t *chunk, size_t len, uint8_t *ecc)
+{
+	hamming_generate_ext(HAMMING_LOG2_CHUNK_SIZE, chunk, len, ecc);
+}
+
+hamming_ecc_t hamming_syndrome(const uint8_t *chunk, size_t len,
+			       const uint8_t *ecc)
+{
+	return hamming_syndrome_ext(HAMMING_LOG2_CHUNK_SIZE, chunk, len, ecc);
+}
+
+int hamming_repair(uint8_t *chunk, size_t len, hamming_ecc_t syndrome)
+{
+	return hamming_repair_ext(HAMMING_LOG2_CHUNK_SIZE, chunk, len,
+				  syndrome);
+}
@@ -20,8 +20,9 @@
 #include <stdint.h>
 #include <stddef.h>
 
-/* ECC size is fixed. Chunk size can't be any larger than the maximum
- * given below. Hamming codes can correct 1-bit errors and detect 2-bit
+/* For the functions below, ECC size is fixed. Chunk size can't be any
+ * larger than the maximum given below (see hamming_generate_ext() for
+ * other sizes). Hamming codes can correct 1-bit errors and detect 2-bit
  * errors within a chunk.
  */
 #define HAMMING_MAX_CHUNK_SIZE	512
@@ -41,4 +42,29 @@ hamming_ecc_t hamming_syndrome(const uint8_t *chunk, size_t len,
  */
 int hamming_repair(uint8_t *chunk, size_t len, hamming_ecc_t syndrome);
 
+/* Hamming codes over larger (or smaller) chunks. The chunk size is
+ * given as log2_size, and may be up to HAMMING_MAX_LOG2_CHUNK_SIZE (8
+ * kB). Chunks shorter than the code's size may be supplied.
+ *
+ * The ECC holds two parity bits for each bit of a bit position within
+ * the chunk, and its size in bytes is given by hamming_ecc_size(). For
+ * log2_size = 9, these functions are equivalent to those above.
+ */
+#define HAMMING_MAX_LOG2_CHUNK_SIZE	13
+#define HAMMING_MAX_ECC_SIZE		4
+
+static inline int hamming_ecc_size(int log2_size)
+{
+	return (((log2_size + 3) << 1) + 7) >> 3;
+}
+
+void hamming_generate_ext(int log2_size, const uint8_t *chunk, size_t len,
+			  uint8_t *ecc);
+
+hamming_ecc_t hamming_syndrome_ext(int log2_size, const uint8_t *chunk,
+				   size_t len, const uint8_t *ecc);
+
+int hamming_repair_ext(int log2_size, uint8_t *chunk, size_t len,
+		       hamming_ecc_t syndrome);
+
 #endif
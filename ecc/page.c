@@ -0,0 +1,141 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include "page.h"
+#include "hamming.h"
+
+int ecc_page_ecc_size(const struct ecc_page_layout *l)
+{
+	if (l->bch)
+		return l->bch->ecc_bytes;
+
+	return hamming_ecc_size(l->hamming_log2_size);
+}
+
+struct page_job {
+	const struct ecc_page_layout	*layout;
+	uint8_t				*page;
+	int				*corrected;
+};
+
+static void generate_chunk(void *ctx, int i)
+{
+	const struct page_job *j = (const struct page_job *)ctx;
+	const struct ecc_page_layout *l = j->layout;
+	const uint8_t *chunk = j->page + l->data_offset + i * l->data_stride;
+	uint8_t *ecc = j->page + l->ecc_offset + i * l->ecc_stride;
+
+	if (l->bch)
+		bch_generate(l->bch, chunk, l->chunk_size, ecc);
+	else
+		hamming_generate_ext(l->hamming_log2_size,
+				     chunk, l->chunk_size, ecc);
+}
+
+static int correct_bch(const struct ecc_page_layout *l,
+		       uint8_t *chunk, uint8_t *ecc)
+{
+	int n;
+
+	if (!bch_verify(l->bch, chunk, l->chunk_size, ecc))
+		return 0;
+
+	/* Too many errors may be miscorrected, so check the result */
+	n = bch_repair(l->bch, chunk, l->chunk_size, ecc);
+	if ((n < 0) || (bch_verify(l->bch, chunk, l->chunk_size, ecc) < 0))
+		return -1;
+
+	return n;
+}
+
+static int correct_hamming(const struct ecc_page_layout *l,
+			   uint8_t *chunk, uint8_t *ecc)
+{
+	const hamming_ecc_t s = hamming_syndrome_ext(l->hamming_log2_size,
+						     chunk, l->chunk_size,
+						     ecc);
+
+	if (!s)
+		return 0;
+
+	if (hamming_repair_ext(l->hamming_log2_size,
+			       chunk, l->chunk_size, s) < 0)
+		return -1;
+
+	return 1;
+}
+
+static void correct_chunk(void *ctx, int i)
+{
+	const struct page_job *j = (const struct page_job *)ctx;
+	const struct ecc_page_layout *l = j->layout;
+	uint8_t *chunk = j->page + l->data_offset + i * l->data_stride;
+	uint8_t *ecc = j->page + l->ecc_offset + i * l->ecc_stride;
+
+	j->corrected[i] = l->bch ? correct_bch(l, chunk, ecc) :
+		correct_hamming(l, chunk, ecc);
+}
+
+static void run_all(const struct ecc_page_runner *runner, int n,
+		    void (*fn)(void *ctx, int i), void *ctx)
+{
+	int i;
+
+	if (runner) {
+		runner->run(runner->arg, n, fn, ctx);
+		return;
+	}
+
+	for (i = 0; i < n; i++)
+		fn(ctx, i);
+}
+
+void ecc_page_generate(const struct ecc_page_layout *l, uint8_t *page,
+		       const struct ecc_page_runner *runner)
+{
+	struct page_job j;
+
+	j.layout = l;
+	j.page = page;
+	j.corrected = NULL;
+
+	run_all(runner, l->chunks, generate_chunk, &j);
+}
+
+int ecc_page_correct(const struct ecc_page_layout *l, uint8_t *page,
+		     int *corrected, const struct ecc_page_runner *runner)
+{
+	struct page_job j;
+	int worst = 0;
+	int i;
+
+	j.layout = l;
+	j.page = page;
+	j.corrected = corrected;
+
+	run_all(runner, l->chunks, correct_chunk, &j);
+
+	for (i = 0; i < l->chunks; i++) {
+		if (corrected[i] < 0)
+			return -1;
+
+		if (corrected[i] > worst)
+			worst = corrected[i];
+	}
+
+	return worst;
+}
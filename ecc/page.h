@@ -0,0 +1,93 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#ifndef ECC_PAGE_H_
+#define ECC_PAGE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "bch.h"
+
+/* Page-level ECC: apply a Hamming or BCH code to each chunk of a raw
+ * page, as read from or written to the chip (main area followed by the
+ * spare area).
+ *
+ * The layout gives the position of each chunk and of its ECC within the
+ * page buffer. For example, with ECC interleaved with the data:
+ *
+ *    data_offset = 0, data_stride = chunk_size + ecc size
+ *    ecc_offset = chunk_size, ecc_stride = data_stride
+ *
+ * Or with all ECC gathered in the spare area, after a two-byte bad
+ * block marker:
+ *
+ *    data_offset = 0, data_stride = chunk_size
+ *    ecc_offset = page_size + 2, ecc_stride = ecc size
+ */
+struct ecc_page_layout {
+	/* Code to use. If bch is NULL, a Hamming code over chunks of up
+	 * to 2^hamming_log2_size bytes is used instead (see hamming.h).
+	 */
+	const struct bch_def	*bch;
+	int			hamming_log2_size;
+
+	/* Number of chunks, and the size of each */
+	int			chunks;
+	size_t			chunk_size;
+
+	/* Offset of the first chunk and of its ECC, and the distance
+	 * between consecutive chunks and ECC fields.
+	 */
+	size_t			data_offset;
+	size_t			data_stride;
+	size_t			ecc_offset;
+	size_t			ecc_stride;
+};
+
+/* Number of ECC bytes per chunk */
+int ecc_page_ecc_size(const struct ecc_page_layout *l);
+
+/* Optional worker pool. run() must call fn(ctx, i) once for each i in
+ * [0, n), possibly concurrently, and return when all calls have
+ * finished. Chunks never share bytes, so the calls are independent.
+ */
+struct ecc_page_runner {
+	void		*arg;
+
+	void		(*run)(void *arg, int n,
+			       void (*fn)(void *ctx, int i), void *ctx);
+};
+
+/* Generate ECC for every chunk of the page. If runner is NULL, the
+ * chunks are processed in order by the calling thread.
+ */
+void ecc_page_generate(const struct ecc_page_layout *l, uint8_t *page,
+		       const struct ecc_page_runner *runner);
+
+/* Check and correct every chunk of the page. For each chunk, corrected
+ * (which must have room for l->chunks entries) receives the number of
+ * bits corrected (in either data or ECC), or -1 if the chunk is
+ * uncorrectable. The return value is the largest number of bits
+ * corrected in any chunk (useful for deciding when to refresh a
+ * block), or -1 if any chunk is uncorrectable.
+ *
+ * A fully erased page passes with no corrections.
+ */
+int ecc_page_correct(const struct ecc_page_layout *l, uint8_t *page,
+		     int *corrected, const struct ecc_page_runner *runner);
+
+#endif
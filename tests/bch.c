@@ -20,8 +20,11 @@
 #include <assert.h>
 #include "ecc/bch.h"
 
-#define BCH_CHUNK_SIZE		512
-#define TEST_CHUNK_SIZE		(BCH_CHUNK_SIZE + 8)
+#define MAX_CHUNK_SIZE		1024
+#define TEST_BUF_SIZE		(MAX_CHUNK_SIZE + BCH_MAX_ECC)
+
+/* Chunk size for the code under test */
+static int chunk_size;
 
 static void flip_one_bit(uint8_t *b, int size)
 {
@@ -35,54 +38,119 @@ static void flip_one_bit(uint8_t *b, int size)
 static void flip_test(const struct bch_def *def,
 		      const uint8_t *good)
 {
-	uint8_t bad[TEST_CHUNK_SIZE];
+	uint8_t bad[TEST_BUF_SIZE];
 	int i;
 
 	memcpy(bad, good, sizeof(bad));
 
 	for (i = 0; i < def->syns; i += 2)
-		flip_one_bit(bad, TEST_CHUNK_SIZE);
+		flip_one_bit(bad, chunk_size + def->ecc_bytes);
 
-	if (bch_verify(def, bad, BCH_CHUNK_SIZE, bad + BCH_CHUNK_SIZE) < 0) {
-		bch_repair(def, bad, BCH_CHUNK_SIZE, bad + BCH_CHUNK_SIZE);
-		i = bch_verify(def, bad, BCH_CHUNK_SIZE, bad + BCH_CHUNK_SIZE);
+	if (bch_verify(def, bad, chunk_size, bad + chunk_size) < 0) {
+		i = bch_repair(def, bad, chunk_size, bad + chunk_size);
+		assert((i > 0) && (i <= def->syns / 2));
+		i = bch_verify(def, bad, chunk_size, bad + chunk_size);
 		assert(!i);
 	}
 
-	i = memcmp(good, bad, BCH_CHUNK_SIZE);
+	i = memcmp(good, bad, chunk_size);
 	assert(!i);
 }
 
+/* With too many errors, repair must either refuse (leaving the data
+ * untouched), or produce a codeword.
+ */
+static void overflow_test(const struct bch_def *def,
+			  const uint8_t *good)
+{
+	uint8_t bad[TEST_BUF_SIZE];
+	uint8_t copy[TEST_BUF_SIZE];
+	int i;
+
+	memcpy(bad, good, sizeof(bad));
+
+	for (i = 0; i < def->syns + 2; i += 2)
+		flip_one_bit(bad, chunk_size + def->ecc_bytes);
+
+	memcpy(copy, bad, sizeof(copy));
+
+	if (bch_repair(def, bad, chunk_size, bad + chunk_size) < 0) {
+		i = memcmp(copy, bad, sizeof(bad));
+		assert(!i);
+	} else {
+		i = bch_verify(def, bad, chunk_size, bad + chunk_size);
+		assert(!i);
+	}
+}
+
 static void test_properties(const struct bch_def *def,
 			    const uint8_t *block)
 {
 	int i;
 
-	i = bch_verify(def, block, BCH_CHUNK_SIZE, block + BCH_CHUNK_SIZE);
+	i = bch_verify(def, block, chunk_size, block + chunk_size);
 	assert(!i);
 
 	for (i = 0; i < 20; i++)
 		flip_test(def, block);
+
+	for (i = 0; i < 20; i++)
+		overflow_test(def, block);
 }
 
 static void test_random_block(const struct bch_def *def)
 {
-	uint8_t block[TEST_CHUNK_SIZE];
+	uint8_t block[TEST_BUF_SIZE];
 	int i;
 
-	for (i = 0; i < BCH_CHUNK_SIZE; i++)
+	for (i = 0; i < chunk_size; i++)
 		block[i] = random();
 
-	bch_generate(def, block, BCH_CHUNK_SIZE, block + BCH_CHUNK_SIZE);
+	bch_generate(def, block, chunk_size, block + chunk_size);
 	test_properties(def, block);
 }
 
-static void test_code(const struct bch_def *def)
+/* The table-driven remainder must match the bit-serial one */
+static void test_table(const struct bch_def *def)
 {
-	uint8_t block[TEST_CHUNK_SIZE];
+	struct bch_def serial = *def;
+	struct bch_def unfolded = *def;
+	uint8_t block[MAX_CHUNK_SIZE];
+	uint8_t a[BCH_MAX_ECC];
+	uint8_t b[BCH_MAX_ECC];
 	int i;
 
-	printf("nbits: %d\n", def->syns / 2);
+	memset(unfolded.fold, 0, sizeof(unfolded.fold));
+	serial = unfolded;
+	serial.table = NULL;
+	serial.table32 = NULL;
+
+	for (i = 0; i < 10; i++) {
+		const size_t len = random() % (chunk_size + 1);
+		size_t j;
+
+		for (j = 0; j < len; j++)
+			block[j] = random();
+
+		bch_generate(def, block, len, a);
+		bch_generate(&serial, block, len, b);
+		assert(!memcmp(a, b, def->ecc_bytes));
+
+		bch_generate(&unfolded, block, len, b);
+		assert(!memcmp(a, b, def->ecc_bytes));
+	}
+}
+
+static void test_code(const struct bch_def *def, int size)
+{
+	uint8_t block[TEST_BUF_SIZE];
+	int i;
+
+	printf("nbits: %d, chunk size: %d\n", def->syns / 2, size);
+	assert(size <= bch_max_chunk_size(def));
+	chunk_size = size;
+
+	test_table(def);
 
 	memset(block, 0xff, sizeof(block));
 	test_properties(def, block);
@@ -94,10 +162,13 @@ static void test_code(const struct bch_def *def)
 int main(void)
 {
 	srandom(0);
-	test_code(&bch_1bit);
-	test_code(&bch_2bit);
-	test_code(&bch_3bit);
-	test_code(&bch_4bit);
+	test_code(&bch_1bit, 512);
+	test_code(&bch_2bit, 512);
+	test_code(&bch_3bit, 512);
+	test_code(&bch_4bit, 512);
+	test_code(&bch_8bit, 512);
+	test_code(&bch_16bit, 512);
+	test_code(&bch_24bit, 1024);
 
 	return 0;
 }
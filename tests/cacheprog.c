@@ -0,0 +1,77 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <assert.h>
+#include "dhara/map.h"
+#include "util.h"
+#include "mtutil.h"
+#include "sim.h"
+
+static int op_count;
+static int cp_outstanding;
+
+/* Count the operations which return with a checkpoint outstanding */
+static void count_outstanding(struct dhara_map *m)
+{
+	op_count++;
+	if (m->journal.flags & DHARA_JOURNAL_F_CP_PENDING)
+		cp_outstanding++;
+}
+
+static void run(uint8_t *spare_buf)
+{
+	const size_t page_size = 1 << sim_nand.log2_page_size;
+	uint8_t page_buf[page_size];
+	struct dhara_map map;
+
+	op_count = 0;
+	cp_outstanding = 0;
+
+	sim_reset();
+	sim_inject_bad(10);
+	sim_inject_timebombs(30, 20);
+
+	printf("Map init (%s spare buffer)\n", spare_buf ? "with" : "no");
+	dhara_map_init(&map, &sim_nand, page_buf, MT_GC_RATIO);
+	dhara_journal_set_spare_buf(&map.journal, spare_buf);
+	dhara_map_resume(&map, NULL);
+	printf("  capacity: %d\n", dhara_map_capacity(&map));
+	printf("  sector count: %d\n", MT_NUM_SECTORS);
+	printf("\n");
+
+	mt_hook = count_outstanding;
+	mt_sequence(&map);
+
+	printf("  operations: %d, checkpoints left outstanding: %d\n",
+	       op_count, cp_outstanding);
+	if (spare_buf)
+		assert(cp_outstanding > 0);
+	else
+		assert(!cp_outstanding);
+
+	sim_dump();
+}
+
+int main(void)
+{
+	uint8_t spare_buf[1 << 9];
+
+	run(NULL);
+	run(spare_buf);
+	return 0;
+}
@@ -0,0 +1,134 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include "dhara/map.h"
+#include "dhara/chips.h"
+#include "util.h"
+#include "mtutil.h"
+#include "sim.h"
+
+#define LOG2_CHIPS		2
+#define NUM_CHIPS		(1 << LOG2_CHIPS)
+#define ROUNDS			3
+
+/* The simulated chip is divided into four identical chips. Because
+ * their blocks are numbered consecutively, composite addresses are
+ * also simulator addresses.
+ */
+static struct dhara_nand chip;
+static struct dhara_chips chips;
+
+/* Check the sector through the map. Returns the chip on which it's
+ * stored.
+ */
+static int chip_assert(struct dhara_map *m, dhara_sector_t s, int seed)
+{
+	dhara_error_t err;
+	dhara_page_t loc;
+	dhara_page_t local;
+	unsigned int c;
+
+	mt_assert(m, s, seed);
+
+	if (dhara_map_find(m, s, &loc, &err) < 0)
+		dabort("map_find", err);
+
+	c = dhara_chips_page(&chips, dhara_nand_page_addr(&chips.nand, loc),
+			     &local);
+	assert(c < NUM_CHIPS);
+	assert((local >> chip.log2_ppb) < chip.num_blocks);
+
+	return c;
+}
+
+static void check_mapping(void)
+{
+	static uint8_t seen[1024];
+	dhara_block_t b;
+
+	assert(chips.nand.num_blocks <= sizeof(seen));
+	memset(seen, 0, sizeof(seen));
+
+	for (b = 0; b < chips.nand.num_blocks; b++) {
+		const dhara_block_t p = dhara_nand_block_addr(&chips.nand, b);
+		dhara_block_t local;
+		const unsigned int c = dhara_chips_block(&chips, p, &local);
+
+		assert(p < chips.nand.num_blocks);
+		assert(!seen[p]);
+		seen[p] = 1;
+
+		assert(c < NUM_CHIPS);
+		assert(local < chip.num_blocks);
+		assert(c * chip.num_blocks + local == p);
+
+		assert(c == b / chip.num_blocks);
+	}
+}
+
+int main(void)
+{
+	const size_t page_size = 1 << sim_nand.log2_page_size;
+	uint8_t page_buf[page_size];
+	struct dhara_map map;
+	int count[NUM_CHIPS] = {0};
+	int r;
+	int i;
+
+	chip = sim_nand;
+	chip.num_blocks = sim_nand.num_blocks >> LOG2_CHIPS;
+
+	printf("Concatenating %d chips\n", NUM_CHIPS);
+	dhara_chips_init(&chips, &chip, LOG2_CHIPS);
+	assert(chips.nand.num_blocks == chip.num_blocks * NUM_CHIPS);
+	check_mapping();
+
+	sim_reset();
+	sim_inject_bad(10);
+	sim_inject_timebombs(30, 20);
+
+	dhara_map_init(&map, &chips.nand, page_buf, MT_GC_RATIO);
+	dhara_map_resume(&map, NULL);
+	printf("  capacity: %d\n", dhara_map_capacity(&map));
+
+	for (r = 0; r < ROUNDS; r++) {
+		printf("Round %d...\n", r);
+		for (i = 0; i < MT_NUM_SECTORS; i++)
+			mt_write(&map, i, r * MT_NUM_SECTORS + i);
+	}
+
+	printf("Sync/resume...\n");
+	mt_resume(&map);
+
+	printf("Read back...\n");
+	for (i = 0; i < MT_NUM_SECTORS; i++) {
+		const int seed = (ROUNDS - 1) * MT_NUM_SECTORS + i;
+
+		count[chip_assert(&map, i, seed)]++;
+	}
+
+	printf("  sectors per chip:");
+	for (i = 0; i < NUM_CHIPS; i++)
+		printf(" %d", count[i]);
+	printf("\n\n");
+
+	sim_dump();
+	return 0;
+}
@@ -60,6 +60,63 @@ static void test_random_block(void)
 		test_hd(block, crc, 4);
 }
 
+/* Bit-serial reference, against which accelerated kernels are checked */
+static uint32_t ref_crc(const uint8_t *block, size_t len, uint32_t c)
+{
+	size_t i;
+
+	c = ~c;
+
+	for (i = 0; i < len; i++) {
+		int j;
+
+		c ^= block[i] ^ 0xff;
+		for (j = 0; j < 8; j++)
+			c = (c & 1) ? ((c >> 1) ^ 0xedb88320) : (c >> 1);
+	}
+
+	return ~c;
+}
+
+static void test_reference(void)
+{
+	uint8_t buf[BLOCK_SIZE * 2 + 16];
+	int i;
+
+	for (i = 0; i < (int)sizeof(buf); i++)
+		buf[i] = random();
+
+	for (i = 0; i < 200; i++) {
+		const size_t offset = random() % 16;
+		const size_t len = random() % (sizeof(buf) - offset + 1);
+		const uint32_t carry = (i & 1) ? random() : CRC32_INIT;
+
+		assert(crc32_nand(buf + offset, len, carry) ==
+		       ref_crc(buf + offset, len, carry));
+	}
+}
+
+static void test_combine(void)
+{
+	uint8_t buf[BLOCK_SIZE * 2];
+	int i;
+
+	for (i = 0; i < (int)sizeof(buf); i++)
+		buf[i] = random();
+
+	for (i = 0; i < 100; i++) {
+		const size_t len = random() % (sizeof(buf) + 1);
+		const size_t split = random() % (len + 1);
+		const uint32_t carry = (i & 1) ? random() : CRC32_INIT;
+		const uint32_t a = crc32_nand(buf, split, carry);
+		const uint32_t b = crc32_nand(buf + split, len - split,
+					      CRC32_INIT);
+
+		assert(crc32_nand_combine(a, b, len - split) ==
+		       crc32_nand(buf, len, carry));
+	}
+}
+
 int main(void)
 {
 	uint8_t block[BLOCK_SIZE];
@@ -72,5 +129,8 @@ int main(void)
 	for (i = 0; i < 10; i++)
 		test_random_block();
 
+	test_reference();
+	test_combine();
+
 	return 0;
 }
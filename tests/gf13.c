@@ -0,0 +1,59 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include "ecc/gf13.h"
+
+/* Bit-serial reference multiply */
+static gf13_elem_t ref_mul(gf13_elem_t a, gf13_elem_t b)
+{
+	gf13_elem_t r = 0;
+	int i;
+
+	for (i = 12; i >= 0; i--) {
+		r <<= 1;
+		if (r & 8192)
+			r ^= 0x201b;
+
+		if ((b >> i) & 1)
+			r ^= a;
+	}
+
+	return r;
+}
+
+int main(void)
+{
+	int i;
+
+	srandom(0);
+
+	for (i = 0; i < 100000; i++) {
+		const gf13_elem_t a = (random() % GF13_ORDER) + 1;
+		const gf13_elem_t b = (random() % GF13_ORDER) + 1;
+		const gf13_elem_t p = gf13_mul(a, b);
+
+		assert(p == ref_mul(a, b));
+		assert(gf13_div(p, b) == a);
+		assert(gf13_mulx(a) == ref_mul(a, 2));
+		assert(gf13_mulx(gf13_divx(a)) == a);
+	}
+
+	return 0;
+}
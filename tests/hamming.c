@@ -20,8 +20,12 @@
 #include <assert.h>
 #include "ecc/hamming.h"
 
-#define HAMMING_CHUNK_SIZE	512
-#define TEST_CHUNK_SIZE		(HAMMING_CHUNK_SIZE + HAMMING_ECC_SIZE)
+#define MAX_CHUNK_SIZE		(1 << HAMMING_MAX_LOG2_CHUNK_SIZE)
+#define TEST_BUF_SIZE		(MAX_CHUNK_SIZE + HAMMING_MAX_ECC_SIZE)
+
+static int log2_size;
+static int chunk_size;
+static int ecc_size;
 
 static void flip_one_bit(uint8_t *b, int size)
 {
@@ -34,19 +38,19 @@ static void flip_one_bit(uint8_t *b, int size)
 
 static void flip_test(const uint8_t *good)
 {
-	uint8_t bad[TEST_CHUNK_SIZE];
+	uint8_t bad[TEST_BUF_SIZE];
 	int i;
 	hamming_ecc_t e;
 
-	memcpy(bad, good, sizeof(bad));
-	flip_one_bit(bad, TEST_CHUNK_SIZE);
+	memcpy(bad, good, chunk_size + ecc_size);
+	flip_one_bit(bad, chunk_size + ecc_size);
 
-	e = hamming_syndrome(bad, HAMMING_CHUNK_SIZE,
-			     bad + HAMMING_CHUNK_SIZE);
+	e = hamming_syndrome_ext(log2_size, bad, chunk_size,
+				 bad + chunk_size);
 	assert(e);
-	hamming_repair(bad, HAMMING_CHUNK_SIZE, e);
+	hamming_repair_ext(log2_size, bad, chunk_size, e);
 
-	i = memcmp(good, bad, HAMMING_CHUNK_SIZE);
+	i = memcmp(good, bad, chunk_size);
 	assert(!i);
 }
 
@@ -55,8 +59,8 @@ static void test_properties(const uint8_t *block)
 	hamming_ecc_t e;
 	int i;
 
-	e = hamming_syndrome(block, HAMMING_CHUNK_SIZE,
-			     block + HAMMING_CHUNK_SIZE);
+	e = hamming_syndrome_ext(log2_size, block, chunk_size,
+				 block + chunk_size);
 	assert(!e);
 
 	for (i = 0; i < 20; i++)
@@ -65,33 +69,99 @@ static void test_properties(const uint8_t *block)
 
 static void test_random_block(void)
 {
-	uint8_t block[TEST_CHUNK_SIZE];
+	uint8_t block[TEST_BUF_SIZE];
 	int i;
 
-	for (i = 0; i < HAMMING_CHUNK_SIZE; i++)
+	for (i = 0; i < chunk_size; i++)
 		block[i] = random();
 
-	hamming_generate(block, HAMMING_CHUNK_SIZE,
-			 block + HAMMING_CHUNK_SIZE);
+	hamming_generate_ext(log2_size, block, chunk_size,
+			     block + chunk_size);
 	test_properties(block);
 }
 
-static void test_code(void)
+/* Bit-serial reference: the parity of the set bits whose positions
+ * have bit m clear (Pm) and set (Pm'), for each m, ordered from the
+ * highest pair down to P0' and inverted.
+ */
+static hamming_ecc_t ref_ecc(const uint8_t *chunk, size_t len)
+{
+	int par[HAMMING_MAX_LOG2_CHUNK_SIZE + 3][2] = {{0}};
+	hamming_ecc_t out = 0;
+	int p;
+	int m;
+
+	for (p = 0; p < len * 8; p++)
+		if ((chunk[p >> 3] >> (p & 7)) & 1)
+			for (m = 0; m < log2_size + 3; m++)
+				par[m][(p >> m) & 1] ^= 1;
+
+	for (m = log2_size + 2; m >= 0; m--) {
+		out = (out << 1) | par[m][0];
+		out = (out << 1) | par[m][1];
+	}
+
+	return out ^ (((hamming_ecc_t)~0) >> (32 - ecc_size * 8));
+}
+
+static void test_reference(void)
+{
+	uint8_t block[MAX_CHUNK_SIZE];
+	int i;
+
+	for (i = 0; i < 20; i++) {
+		const size_t len = random() % (chunk_size + 1);
+		uint8_t ecc[HAMMING_MAX_ECC_SIZE];
+		hamming_ecc_t e;
+		size_t j;
+
+		for (j = 0; j < len; j++)
+			block[j] = random();
+
+		e = ref_ecc(block, len);
+		hamming_generate_ext(log2_size, block, len, ecc);
+
+		for (j = 0; j < ecc_size; j++)
+			assert(ecc[j] == ((e >> (j * 8)) & 0xff));
+
+		/* The original interface is the 512-byte code */
+		if (log2_size == 9) {
+			hamming_generate(block, len, ecc);
+
+			for (j = 0; j < ecc_size; j++)
+				assert(ecc[j] == ((e >> (j * 8)) & 0xff));
+		}
+	}
+}
+
+static void test_code(int log2)
 {
-	uint8_t block[TEST_CHUNK_SIZE];
+	uint8_t block[TEST_BUF_SIZE];
 	int i;
 
+	log2_size = log2;
+	chunk_size = 1 << log2;
+	ecc_size = hamming_ecc_size(log2);
+	printf("chunk size: %d, ecc size: %d\n", chunk_size, ecc_size);
+
 	memset(block, 0xff, sizeof(block));
 	test_properties(block);
 
 	for (i = 0; i < 10; i++)
 		test_random_block();
+
+	test_reference();
 }
 
 int main(void)
 {
+	int i;
+
 	srandom(0);
-	test_code();
+	assert(hamming_ecc_size(9) == HAMMING_ECC_SIZE);
+
+	for (i = 8; i <= HAMMING_MAX_LOG2_CHUNK_SIZE; i++)
+		test_code(i);
 
 	return 0;
 }
@@ -23,6 +23,27 @@
 #include "util.h"
 #include "jtutil.h"
 
+/* Upper bound on the NAND operations needed to resume. There's a
+ * binary search over blocks, with up to two probes per step, each an
+ * is_bad() check and a read. Then there's a binary search over the
+ * groups of the last block, with up to two groups checked per step.
+ * Finally, up to one read per group finds the root, and one group is
+ * probed to find the head.
+ */
+static unsigned int resume_bound(const struct dhara_journal *j)
+{
+	const unsigned int log2_groups = j->nand->log2_ppb - j->log2_ppc;
+	const unsigned int ppc = 1 << j->log2_ppc;
+	unsigned int log2_blocks = 0;
+
+	while ((1u << log2_blocks) < j->nand->num_blocks)
+		log2_blocks++;
+
+	return 4 * (log2_blocks + 1) +
+		2 * ppc * (log2_groups + 1) +
+		(1 << log2_groups) + ppc;
+}
+
 static void suspend_resume(struct dhara_journal *j)
 {
 	const dhara_page_t old_root = dhara_journal_root(j);
@@ -39,6 +60,9 @@ static void suspend_resume(struct dhara_journal *j)
 	assert(old_root == dhara_journal_root(j));
 	assert(old_tail == j->tail);
 	assert(old_head == j->head);
+
+	printf("    resume_ops = %u\n", j->resume_ops);
+	assert(j->resume_ops <= resume_bound(j));
 }
 
 static void dump_info(struct dhara_journal *j)
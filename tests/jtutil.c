@@ -25,7 +25,7 @@ static void check_upage(const struct dhara_journal *j, dhara_page_t p)
 {
 	const dhara_page_t mask = (1 << j->log2_ppc) - 1;
 
-	assert((~p) & mask);
+	assert((p & mask) < mask + 1 - j->meta_pages);
 	assert(p < (j->nand->num_blocks << j->nand->log2_ppb));
 }
 
@@ -0,0 +1,61 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <assert.h>
+#include "dhara/map.h"
+#include "util.h"
+#include "mtutil.h"
+#include "sim.h"
+
+#define META_PAGES		2
+
+int main(void)
+{
+	const size_t page_size = 1 << sim_nand.log2_page_size;
+	uint8_t meta_buf[META_PAGES * page_size];
+	struct dhara_map map;
+
+	sim_reset();
+	sim_inject_bad(10);
+	sim_inject_timebombs(30, 20);
+
+	printf("Map init\n");
+	dhara_map_init(&map, &sim_nand, meta_buf, MT_GC_RATIO);
+	dhara_journal_set_meta_buf(&map.journal, meta_buf, META_PAGES);
+	dhara_map_resume(&map, NULL);
+	printf("  log2_ppc: %d\n", map.journal.log2_ppc);
+	printf("  meta pages: %d\n", map.journal.meta_pages);
+	printf("  capacity: %d\n", dhara_map_capacity(&map));
+	printf("  sector count: %d\n", MT_NUM_SECTORS);
+	printf("\n");
+
+	/* Six user pages per group of eight: three records on the
+	 * checkpoint page, and three on the page before it.
+	 */
+	assert(map.journal.meta_pages == META_PAGES);
+	assert(map.journal.log2_ppc == 3);
+
+	mt_sequence(&map);
+
+	/* The metadata layout survives resume */
+	assert(map.journal.meta_pages == META_PAGES);
+	assert(map.journal.log2_ppc == 3);
+
+	sim_dump();
+	return 0;
+}
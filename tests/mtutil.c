@@ -0,0 +1,157 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include "util.h"
+#include "mtutil.h"
+
+dhara_sector_t mt_sector_list[MT_NUM_SECTORS];
+void (*mt_hook)(struct dhara_map *m);
+
+/* Write buffers, used alternately */
+static uint8_t write_buf[2][1 << 9];
+static int write_index;
+
+void mt_shuffle(int seed)
+{
+	int i;
+
+	srandom(seed);
+	for (i = 0; i < MT_NUM_SECTORS; i++)
+		mt_sector_list[i] = i;
+
+	for (i = MT_NUM_SECTORS - 1; i > 0; i--) {
+		const int j = random() % i;
+		const int tmp = mt_sector_list[i];
+
+		mt_sector_list[i] = mt_sector_list[j];
+		mt_sector_list[j] = tmp;
+	}
+}
+
+int mt_try_write(struct dhara_map *m, dhara_sector_t s, int seed,
+		 dhara_error_t *err)
+{
+	const size_t page_size = 1 << m->journal.nand->log2_page_size;
+	uint8_t *buf = write_buf[write_index];
+
+	assert(page_size <= sizeof(write_buf[0]));
+	write_index ^= 1;
+	seq_gen(seed, buf, page_size);
+
+	if (dhara_map_write(m, s, buf, err) < 0)
+		return -1;
+
+	if (mt_hook)
+		mt_hook(m);
+
+	return 0;
+}
+
+void mt_write(struct dhara_map *m, dhara_sector_t s, int seed)
+{
+	dhara_error_t err;
+
+	if (mt_try_write(m, s, seed, &err) < 0)
+		dabort("map_write", err);
+}
+
+void mt_assert(struct dhara_map *m, dhara_sector_t s, int seed)
+{
+	const size_t page_size = 1 << m->journal.nand->log2_page_size;
+	uint8_t buf[page_size];
+	dhara_error_t err;
+
+	if (dhara_map_read(m, s, buf, &err) < 0)
+		dabort("map_read", err);
+
+	seq_assert(seed, buf, sizeof(buf));
+}
+
+void mt_assert_blank(struct dhara_map *m, dhara_sector_t s)
+{
+	dhara_error_t err;
+	dhara_page_t loc;
+
+	assert(dhara_map_find(m, s, &loc, &err) < 0);
+	assert(err == DHARA_E_NOT_FOUND);
+}
+
+void mt_trim(struct dhara_map *m, dhara_sector_t s)
+{
+	dhara_error_t err;
+
+	if (dhara_map_trim(m, s, &err) < 0)
+		dabort("map_trim", err);
+
+	if (mt_hook)
+		mt_hook(m);
+}
+
+void mt_resume(struct dhara_map *m)
+{
+	const struct dhara_nand *n = m->journal.nand;
+	uint8_t *const page_buf = m->journal.page_buf;
+	uint8_t *const spare_buf = m->journal.spare_buf;
+	const uint8_t meta_pages = m->journal.meta_pages;
+	dhara_error_t err;
+
+	if (dhara_map_sync(m, &err) < 0)
+		dabort("map_sync", err);
+
+	assert(!dhara_map_init(m, n, page_buf, m->gc_ratio));
+	if (meta_pages > 1)
+		dhara_journal_set_meta_buf(&m->journal, page_buf, meta_pages);
+	dhara_journal_set_spare_buf(&m->journal, spare_buf);
+
+	if (dhara_map_resume(m, &err) < 0)
+		dabort("map_resume", err);
+}
+
+void mt_sequence(struct dhara_map *m)
+{
+	int i;
+
+	printf("Writing sectors...\n");
+	mt_shuffle(0);
+	for (i = 0; i < MT_NUM_SECTORS; i++)
+		mt_write(m, mt_sector_list[i], mt_sector_list[i]);
+
+	printf("Read back...\n");
+	mt_shuffle(1);
+	for (i = 0; i < MT_NUM_SECTORS; i++)
+		mt_assert(m, mt_sector_list[i], mt_sector_list[i]);
+
+	printf("Rewrite/trim half...\n");
+	mt_shuffle(2);
+	for (i = 0; i < MT_NUM_SECTORS; i += 2) {
+		mt_write(m, mt_sector_list[i], mt_sector_list[i] + 1000);
+		mt_trim(m, mt_sector_list[i + 1]);
+	}
+
+	printf("Sync/resume...\n");
+	mt_resume(m);
+	assert(dhara_map_size(m) == MT_NUM_SECTORS / 2);
+
+	printf("Read back...\n");
+	for (i = 0; i < MT_NUM_SECTORS; i += 2) {
+		mt_assert(m, mt_sector_list[i], mt_sector_list[i] + 1000);
+		mt_assert_blank(m, mt_sector_list[i + 1]);
+	}
+}
@@ -0,0 +1,69 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#ifndef TESTS_MTUTIL_H_
+#define TESTS_MTUTIL_H_
+
+#include "dhara/map.h"
+
+/* Number of sectors used, and the garbage collection ratio */
+#define MT_NUM_SECTORS		200
+#define MT_GC_RATIO		4
+
+/* Sector numbers, in the order chosen by the last mt_shuffle() */
+extern dhara_sector_t mt_sector_list[MT_NUM_SECTORS];
+
+/* If set, this is called after every write or trim made through
+ * mt_write() or mt_trim(), to check feature-specific state.
+ */
+extern void (*mt_hook)(struct dhara_map *m);
+
+/* Fill the sector list with a random permutation */
+void mt_shuffle(int seed);
+
+/* Write a seed/payload sector. The data buffer stays valid until the
+ * write after next, as is required when built with DHARA_NAND_ASYNC.
+ * Returns 0 on success, or -1 with err set.
+ */
+int mt_try_write(struct dhara_map *m, dhara_sector_t s, int seed,
+		 dhara_error_t *err);
+
+/* As for mt_try_write(), but all errors are fatal */
+void mt_write(struct dhara_map *m, dhara_sector_t s, int seed);
+
+/* Check that a sector holds the given seed/payload */
+void mt_assert(struct dhara_map *m, dhara_sector_t s, int seed);
+
+/* Check that a sector is unmapped */
+void mt_assert_blank(struct dhara_map *m, dhara_sector_t s);
+
+/* Trim a sector */
+void mt_trim(struct dhara_map *m, dhara_sector_t s);
+
+/* Sync the map, then reinitialize and resume it with the same chip
+ * and buffers, as though after a power cycle.
+ */
+void mt_resume(struct dhara_map *m);
+
+/* Write every sector in a random order and read them back. Then
+ * rewrite half and trim the other half, resume, and check the result.
+ * On return, the even-numbered entries of the sector list hold seed
+ * (sector + 1000), and the odd-numbered entries are unmapped.
+ */
+void mt_sequence(struct dhara_map *m);
+
+#endif
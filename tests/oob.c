@@ -0,0 +1,77 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include "dhara/map.h"
+#include "util.h"
+#include "mtutil.h"
+#include "sim.h"
+
+/* Check that a sector's metadata is stored in its own spare area */
+static void check_oob(struct dhara_map *m, dhara_sector_t s)
+{
+	uint8_t meta[DHARA_META_SIZE];
+	uint8_t oob[DHARA_META_SIZE];
+	dhara_error_t err;
+	dhara_page_t loc;
+
+	if (dhara_map_find(m, s, &loc, &err) < 0)
+		dabort("map_find", err);
+
+	if (dhara_journal_read_meta(&m->journal, loc, meta, &err) < 0)
+		dabort("read_meta", err);
+
+	if (dhara_nand_read_oob(m->journal.nand,
+				dhara_nand_page_addr(m->journal.nand, loc),
+				0, sizeof(oob), oob, &err) < 0)
+		dabort("nand_read_oob", err);
+
+	assert(!memcmp(meta, oob, sizeof(meta)));
+}
+
+int main(void)
+{
+	const size_t page_size = 1 << sim_nand.log2_page_size;
+	uint8_t page_buf[page_size];
+	struct dhara_map map;
+	int i;
+
+	sim_reset();
+	sim_inject_bad(10);
+	sim_inject_timebombs(30, 20);
+
+	printf("Map init\n");
+	dhara_map_init(&map, &sim_nand, page_buf, MT_GC_RATIO);
+	dhara_map_resume(&map, NULL);
+	printf("  capacity: %d\n", dhara_map_capacity(&map));
+	printf("  sector count: %d\n", MT_NUM_SECTORS);
+	printf("\n");
+
+	/* One checkpoint page per block */
+	assert(map.journal.log2_ppc == sim_nand.log2_ppb);
+
+	mt_sequence(&map);
+
+	printf("Check spare areas...\n");
+	for (i = 0; i < MT_NUM_SECTORS; i += 2)
+		check_oob(&map, mt_sector_list[i]);
+
+	sim_dump();
+	return 0;
+}
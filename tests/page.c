@@ -0,0 +1,216 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <pthread.h>
+#include "ecc/page.h"
+#include "ecc/hamming.h"
+
+#define PAGE_SIZE	2048
+#define RAW_SIZE	(PAGE_SIZE + 64)
+#define MAX_CHUNKS	8
+#define WORKERS		3
+
+/* BCH, with ECC interleaved with the data */
+static const struct ecc_page_layout bch_interleaved = {
+	.bch		= &bch_4bit,
+	.chunks		= 4,
+	.chunk_size	= 512,
+	.data_offset	= 0,
+	.data_stride	= 512 + 7,
+	.ecc_offset	= 512,
+	.ecc_stride	= 512 + 7
+};
+
+/* BCH, with ECC in the spare area after the bad block marker */
+static const struct ecc_page_layout bch_spare = {
+	.bch		= &bch_8bit,
+	.chunks		= 4,
+	.chunk_size	= 512,
+	.data_offset	= 0,
+	.data_stride	= 512,
+	.ecc_offset	= PAGE_SIZE + 2,
+	.ecc_stride	= 13
+};
+
+/* Hamming, one chunk per page */
+static const struct ecc_page_layout hamming_whole = {
+	.hamming_log2_size = 11,
+	.chunks		= 1,
+	.chunk_size	= PAGE_SIZE,
+	.data_offset	= 0,
+	.data_stride	= PAGE_SIZE,
+	.ecc_offset	= PAGE_SIZE + 2,
+	.ecc_stride	= 4
+};
+
+/* Simple pthread worker pool: each worker takes every WORKERS'th job */
+struct work {
+	void		(*fn)(void *ctx, int i);
+	void		*ctx;
+	int		n;
+	int		first;
+};
+
+static void *worker(void *arg)
+{
+	const struct work *w = (const struct work *)arg;
+	int i;
+
+	for (i = w->first; i < w->n; i += WORKERS)
+		w->fn(w->ctx, i);
+
+	return NULL;
+}
+
+static void run_threads(void *arg, int n,
+			void (*fn)(void *ctx, int i), void *ctx)
+{
+	pthread_t threads[WORKERS];
+	struct work work[WORKERS];
+	int i;
+
+	(void)arg;
+
+	for (i = 0; i < WORKERS; i++) {
+		work[i].fn = fn;
+		work[i].ctx = ctx;
+		work[i].n = n;
+		work[i].first = i;
+		pthread_create(&threads[i], NULL, worker, &work[i]);
+	}
+
+	for (i = 0; i < WORKERS; i++)
+		pthread_join(threads[i], NULL);
+}
+
+static const struct ecc_page_runner threaded = {
+	.run		= run_threads
+};
+
+/* Flip a bit in the given chunk's data or ECC */
+static void flip_in_chunk(const struct ecc_page_layout *l, uint8_t *page,
+			  int c)
+{
+	const int ecc_size = ecc_page_ecc_size(l);
+	const int which = random() % ((l->chunk_size + ecc_size) * 8);
+	const int byte = which >> 3;
+	uint8_t *p;
+
+	if (byte < l->chunk_size)
+		p = page + l->data_offset + c * l->data_stride + byte;
+	else
+		p = page + l->ecc_offset + c * l->ecc_stride +
+			byte - l->chunk_size;
+
+	*p ^= 1 << (which & 7);
+}
+
+static void test_layout(const struct ecc_page_layout *l,
+			const struct ecc_page_runner *runner)
+{
+	const int max_bits = l->bch ? (l->bch->syns / 2) : 1;
+	uint8_t good[RAW_SIZE];
+	uint8_t bad[RAW_SIZE];
+	int corrected[MAX_CHUNKS];
+	int expect[MAX_CHUNKS];
+	int i;
+
+	/* Erased pages pass */
+	memset(bad, 0xff, sizeof(bad));
+	assert(!ecc_page_correct(l, bad, corrected, runner));
+
+	for (i = 0; i < sizeof(good); i++)
+		good[i] = random();
+
+	ecc_page_generate(l, good, runner);
+	memcpy(bad, good, sizeof(bad));
+	assert(!ecc_page_correct(l, bad, corrected, runner));
+	assert(!memcmp(good, bad, sizeof(bad)));
+
+	/* Correctable errors, with a different count in each chunk */
+	for (i = 0; i < 20; i++) {
+		int worst = 0;
+		int c;
+
+		memcpy(bad, good, sizeof(bad));
+
+		for (c = 0; c < l->chunks; c++) {
+			uint8_t before[RAW_SIZE];
+			int k;
+
+			expect[c] = random() % (max_bits + 1);
+
+			/* Flips may coincide, so count what changed */
+			memcpy(before, bad, sizeof(bad));
+			for (k = 0; k < expect[c]; k++)
+				flip_in_chunk(l, bad, c);
+
+			expect[c] = 0;
+			for (k = 0; k < sizeof(bad); k++) {
+				uint8_t d = before[k] ^ bad[k];
+
+				while (d) {
+					expect[c] += d & 1;
+					d >>= 1;
+				}
+			}
+
+			if (expect[c] > worst)
+				worst = expect[c];
+		}
+
+		assert(ecc_page_correct(l, bad, corrected, runner) == worst);
+		assert(!memcmp(good, bad, sizeof(bad)));
+
+		for (c = 0; c < l->chunks; c++)
+			assert(corrected[c] == expect[c]);
+	}
+
+	/* A chunk with too many errors taints the page, but not the
+	 * counts for other chunks.
+	 */
+	if (l->chunks > 1) {
+		do {
+			memcpy(bad, good, sizeof(bad));
+			flip_in_chunk(l, bad, 0);
+
+			for (i = 0; i < max_bits + 2; i++)
+				bad[l->data_offset + l->data_stride +
+				    (random() % l->chunk_size)] ^= 0x10;
+		} while (ecc_page_correct(l, bad, corrected, runner) >= 0);
+
+		assert(corrected[0] == 1);
+		assert(corrected[1] < 0);
+	}
+}
+
+int main(void)
+{
+	srandom(0);
+
+	test_layout(&bch_interleaved, NULL);
+	test_layout(&bch_interleaved, &threaded);
+	test_layout(&bch_spare, NULL);
+	test_layout(&bch_spare, &threaded);
+	test_layout(&hamming_whole, NULL);
+
+	return 0;
+}
@@ -0,0 +1,142 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include "dhara/map.h"
+#include "dhara/part.h"
+#include "util.h"
+#include "sim.h"
+#include "mtutil.h"
+
+#define NUM_PARTS		3
+#define NUM_SECTORS		60
+
+static const unsigned int part_sizes[NUM_PARTS] = {32, 48, 0};
+
+static struct dhara_nand parts[NUM_PARTS];
+static struct dhara_map maps[NUM_PARTS];
+static uint8_t page_bufs[NUM_PARTS][1 << 9];
+
+static void check_table(void)
+{
+	const unsigned int bad_sizes[2] = {100, 100};
+	struct dhara_nand tmp[2];
+	dhara_error_t err;
+	int i;
+
+	if (dhara_part_split(parts, &sim_nand, part_sizes, NUM_PARTS,
+			     &err) < 0)
+		dabort("part_split", err);
+
+	for (i = 0; i < NUM_PARTS; i++)
+		printf("  partition %d: blocks %d-%d\n", i,
+		       parts[i].first_block,
+		       parts[i].first_block + parts[i].num_blocks - 1);
+
+	assert(parts[0].first_block == 0);
+	assert(parts[1].first_block == part_sizes[0]);
+	assert(parts[2].first_block + parts[2].num_blocks ==
+	       sim_nand.num_blocks);
+
+	/* Tables which don't fit */
+	err = DHARA_E_NONE;
+	assert(dhara_part_split(tmp, &sim_nand, bad_sizes, 2, &err) < 0);
+	assert(err == DHARA_E_PARTITION);
+
+	err = DHARA_E_NONE;
+	assert(dhara_part_init(tmp, &sim_nand, sim_nand.num_blocks, 1,
+			       &err) < 0);
+	assert(err == DHARA_E_PARTITION);
+
+	/* A partition of a partition */
+	if (dhara_part_init(tmp, &parts[1], 8, 8, &err) < 0)
+		dabort("part_init", err);
+	assert(tmp->first_block == parts[1].first_block + 8);
+	assert(dhara_part_init(tmp, &parts[1], 40, 9, &err) < 0);
+}
+
+/* Check the sector, and that it's stored within its partition */
+static void part_assert(int i, dhara_sector_t s, int seed)
+{
+	dhara_error_t err;
+	dhara_page_t loc;
+	dhara_block_t b;
+
+	mt_assert(&maps[i], s, seed);
+
+	if (dhara_map_find(&maps[i], s, &loc, &err) < 0)
+		dabort("map_find", err);
+
+	b = dhara_nand_page_addr(&parts[i], loc) >> sim_nand.log2_ppb;
+	assert(b >= parts[i].first_block);
+	assert(b < parts[i].first_block + parts[i].num_blocks);
+}
+
+static int seed_of(int i, dhara_sector_t s, int round)
+{
+	return i * 10000 + round * 1000 + s;
+}
+
+int main(void)
+{
+	int r;
+	int i;
+	int s;
+
+	printf("Partition table\n");
+	check_table();
+	printf("\n");
+
+	sim_reset();
+	sim_inject_bad(10);
+	sim_inject_timebombs(30, 20);
+
+	for (i = 0; i < NUM_PARTS; i++) {
+		dhara_map_init(&maps[i], &parts[i], page_bufs[i], MT_GC_RATIO);
+		dhara_map_resume(&maps[i], NULL);
+		printf("Partition %d capacity: %d\n", i,
+		       dhara_map_capacity(&maps[i]));
+	}
+
+	/* Interleave writes across the partitions. Each map has its own
+	 * journal and garbage collection.
+	 */
+	for (r = 0; r < 4; r++) {
+		printf("Round %d...\n", r);
+
+		for (s = 0; s < NUM_SECTORS; s++)
+			for (i = 0; i < NUM_PARTS; i++)
+				mt_write(&maps[i], s, seed_of(i, s, r));
+
+		for (i = 0; i < NUM_PARTS; i++)
+			for (s = 0; s < NUM_SECTORS; s++)
+				part_assert(i, s, seed_of(i, s, r));
+	}
+
+	printf("Sync/resume...\n");
+	for (i = 0; i < NUM_PARTS; i++) {
+		mt_resume(&maps[i]);
+		assert(dhara_map_size(&maps[i]) == NUM_SECTORS);
+		for (s = 0; s < NUM_SECTORS; s++)
+			part_assert(i, s, seed_of(i, s, r - 1));
+	}
+
+	sim_dump();
+	return 0;
+}
@@ -0,0 +1,71 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <assert.h>
+#include "dhara/map.h"
+#include "util.h"
+#include "mtutil.h"
+#include "sim.h"
+
+#define ROUNDS			3
+
+int main(void)
+{
+	const size_t page_size = 1 << sim_nand.log2_page_size;
+	uint8_t page_buf[page_size];
+	struct dhara_nand nand = sim_nand;
+	struct dhara_map map;
+	int group_erases = 0;
+	int r;
+	int i;
+
+	nand.num_blocks &= ~1;
+	nand.log2_planes = 1;
+
+	sim_reset();
+	sim_inject_bad(10);
+	sim_inject_timebombs(30, 20);
+
+	printf("Map init\n");
+	assert(!dhara_map_init(&map, &nand, page_buf, MT_GC_RATIO));
+	dhara_map_resume(&map, NULL);
+	printf("  capacity: %d\n", dhara_map_capacity(&map));
+
+	for (r = 0; r < ROUNDS; r++) {
+		for (i = 0; i < MT_NUM_SECTORS; i++) {
+			const dhara_block_t g = map.journal.erased_group;
+
+			mt_write(&map, i, r * MT_NUM_SECTORS + i);
+
+			if ((map.journal.erased_group != DHARA_BLOCK_NONE) &&
+			    (map.journal.erased_group != g))
+				group_erases++;
+		}
+	}
+
+	mt_resume(&map);
+
+	for (i = 0; i < MT_NUM_SECTORS; i++)
+		mt_assert(&map, i, (ROUNDS - 1) * MT_NUM_SECTORS + i);
+
+	printf("  group erases: %d\n", group_erases);
+	assert(group_erases > 0);
+
+	sim_dump();
+	return 0;
+}
@@ -0,0 +1,161 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <assert.h>
+#include "dhara/map.h"
+#include "util.h"
+#include "mtutil.h"
+#include "sim.h"
+
+#define NUM_SECTORS		100
+
+static void rt_assert(struct dhara_map *m, const struct dhara_map_reader *r,
+		      dhara_sector_t s, int seed)
+{
+	const size_t page_size = 1 << m->journal.nand->log2_page_size;
+	uint8_t buf[page_size];
+	dhara_error_t err;
+
+	sim_set_concurrent_reads(1);
+	if (dhara_map_reader_read(m, r, s, buf, &err) < 0)
+		dabort("reader_read", err);
+	sim_set_concurrent_reads(0);
+
+	seq_assert(seed, buf, sizeof(buf));
+}
+
+/* Write rounds of all sectors until the journal fills, checking the
+ * reader's view at every step. Returns the last complete round.
+ */
+static int write_until_full(struct dhara_map *m,
+			    const struct dhara_map_reader *r,
+			    int round, int reader_round)
+{
+	for (;;) {
+		int i;
+
+		for (i = 0; i < NUM_SECTORS; i++) {
+			dhara_error_t err;
+
+			if (mt_try_write(m, i, round * NUM_SECTORS + i,
+					 &err) < 0) {
+				if (err != DHARA_E_JOURNAL_FULL)
+					dabort("map_write", err);
+
+				return round - 1;
+			}
+
+			rt_assert(m, r, i, reader_round * NUM_SECTORS + i);
+		}
+
+		round++;
+	}
+}
+
+int main(void)
+{
+	const size_t page_size = 1 << sim_nand.log2_page_size;
+	struct dhara_map map;
+	struct dhara_map_reader r0;
+	struct dhara_map_reader r1;
+	struct dhara_map_reader r2;
+	uint8_t page_buf[page_size];
+	dhara_error_t err;
+	dhara_page_t pending;
+	int round;
+	int i;
+
+	sim_reset();
+	dhara_map_init(&map, &sim_nand, page_buf, MT_GC_RATIO);
+	dhara_map_resume(&map, NULL);
+
+	for (i = 0; i < NUM_SECTORS; i++)
+		mt_write(&map, i, i);
+
+	/* Unsynchronized changes are invisible to readers */
+	if (dhara_map_sync(&map, &err) < 0)
+		dabort("map_sync", err);
+	mt_write(&map, 0, 12345);
+
+	printf("Begin reader 0...\n");
+	dhara_map_reader_begin(&map, &r0);
+	rt_assert(&map, &r0, 0, 0);
+	mt_assert(&map, 0, 12345);
+
+	/* The oldest reader determines the pin */
+	dhara_map_reader_begin(&map, &r2);
+	assert(map.journal.tail_pin == r0.watermark);
+	dhara_map_reader_end(&map, &r2);
+	assert(map.journal.tail_pin == r0.watermark);
+
+	round = write_until_full(&map, &r0, 1, 0);
+	printf("Journal full after round %d\n", round);
+	assert(round > 1);
+
+	printf("End reader 0...\n");
+	dhara_map_reader_end(&map, &r0);
+	assert(map.journal.tail_pin == DHARA_PAGE_NONE);
+
+	round += 2;
+	for (i = 0; i < NUM_SECTORS; i++)
+		mt_write(&map, i, round * NUM_SECTORS + i);
+
+	printf("Begin reader 1...\n");
+	if (dhara_map_sync(&map, &err) < 0)
+		dabort("map_sync", err);
+	dhara_map_reader_begin(&map, &r1);
+	assert(map.journal.tail_pin == r1.watermark);
+
+	round = write_until_full(&map, &r1, round + 1, round);
+	printf("Journal full after round %d\n", round);
+
+	printf("End reader 1...\n");
+	dhara_map_reader_end(&map, &r1);
+	assert(map.journal.tail_pin == DHARA_PAGE_NONE);
+
+	for (round = 0; round < 20; round++)
+		for (i = 0; i < NUM_SECTORS; i++)
+			mt_write(&map, i, round * NUM_SECTORS + i);
+
+	for (i = 0; i < NUM_SECTORS; i++)
+		mt_assert(&map, i, 19 * NUM_SECTORS + i);
+
+	/* Readers don't wait for an outstanding write, and never read the
+	 * page being programmed.
+	 */
+	if (dhara_map_sync(&map, &err) < 0)
+		dabort("map_sync", err);
+	mt_write(&map, 0, 12345);
+	pending = map.journal.pending;
+
+	dhara_map_reader_begin(&map, &r2);
+	for (i = 0; i < NUM_SECTORS; i++)
+		rt_assert(&map, &r2, i, 19 * NUM_SECTORS + i);
+	dhara_map_reader_end(&map, &r2);
+	assert(map.journal.pending == pending);
+
+	/* Resuming completes an outstanding write before reading */
+
+	if (dhara_map_resume(&map, &err) < 0)
+		dabort("map_resume", err);
+
+	for (i = 1; i < NUM_SECTORS; i++)
+		mt_assert(&map, i, 19 * NUM_SECTORS + i);
+
+	sim_dump();
+	return 0;
+}
@@ -30,6 +30,10 @@
 #define BLOCK_SIZE		(1 << LOG2_BLOCK_SIZE)
 #define MEM_SIZE		(NUM_BLOCKS * BLOCK_SIZE)
 
+/* Spare area available for out-of-band metadata */
+#define OOB_SIZE		160
+#define OOB_MEM_SIZE		(NUM_BLOCKS * PAGES_PER_BLOCK * OOB_SIZE)
+
 const struct dhara_nand sim_nand = {
 	.log2_page_size		= LOG2_PAGE_SIZE,
 	.log2_ppb		= LOG2_PAGES_PER_BLOCK,
@@ -48,12 +52,15 @@ struct sim_stats {
 
 	int		erase;
 	int		erase_fail;
+	int		erase_multi;
 
 	int		is_erased;
 	int		prog;
 	int		prog_fail;
+	int		prog_async;
 
 	int		read;
+	int		read_oob;
 	int		read_bytes;
 };
 
@@ -71,17 +78,40 @@ struct block_status {
 	int		timebomb;
 };
 
+/* Outstanding split-phase program operations. Up to two may be
+ * outstanding, provided that the second is for the page following the
+ * first (cache program).
+ */
+#define MAX_ASYNC		2
+
+struct async_op {
+	dhara_page_t	page;
+	int		ret;
+	dhara_error_t	err;
+};
+
+struct async_status {
+	int		busy;
+	int		concurrent_reads;
+	dhara_page_t	last_page;
+	struct async_op	ops[MAX_ASYNC];
+};
+
 static struct sim_stats stats;
 static struct block_status blocks[NUM_BLOCKS];
 static uint8_t pages[MEM_SIZE];
+static uint8_t spare[OOB_MEM_SIZE];
+static struct async_status async;
 
 void sim_reset(void)
 {
 	int i;
 
 	memset(&stats, 0, sizeof(stats));
+	memset(&async, 0, sizeof(async));
 	memset(blocks, 0, sizeof(blocks));
 	memset(pages, 0x55, sizeof(pages));
+	memset(spare, 0x55, sizeof(spare));
 
 	for (i = 0; i < NUM_BLOCKS; i++)
 		blocks[i].next_page = PAGES_PER_BLOCK;
@@ -98,8 +128,40 @@ static void timebomb_tick(dhara_block_t blk)
 	}
 }
 
+/* No other operation may be started while a program is outstanding */
+static void check_idle(const char *op)
+{
+	if (async.busy) {
+		fprintf(stderr, "sim: NAND_%s called while a program "
+			"operation is outstanding\n", op);
+		abort();
+	}
+}
+
+/* Concurrent readers may read while a program is outstanding, but
+ * never from a page which is still being programmed.
+ */
+static void check_readable(const char *op, dhara_page_t p)
+{
+	int i;
+
+	if (!async.concurrent_reads) {
+		check_idle(op);
+		return;
+	}
+
+	for (i = 0; i < async.busy; i++)
+		if (async.ops[i].page == p) {
+			fprintf(stderr, "sim: NAND_%s called on page %d "
+				"while it is being programmed\n", op, p);
+			abort();
+		}
+}
+
 int dhara_nand_is_bad(const struct dhara_nand *n, dhara_block_t bno)
 {
+	check_idle("is_bad");
+
 	if (bno >= NUM_BLOCKS) {
 		fprintf(stderr, "sim: NAND_is_bad called on "
 			"invalid block: %d\n", bno);
@@ -113,6 +175,8 @@ int dhara_nand_is_bad(const struct dhara_nand *n, dhara_block_t bno)
 
 void dhara_nand_mark_bad(const struct dhara_nand *n, dhara_block_t bno)
 {
+	check_idle("mark_bad");
+
 	if (bno >= NUM_BLOCKS) {
 		fprintf(stderr, "sim: NAND_mark_bad called on "
 			"invalid block: %d\n", bno);
@@ -128,6 +192,9 @@ int dhara_nand_erase(const struct dhara_nand *n, dhara_block_t bno,
 		     dhara_error_t *err)
 {
 	uint8_t *blk = pages + (bno << LOG2_BLOCK_SIZE);
+	uint8_t *blk_spare = spare + bno * PAGES_PER_BLOCK * OOB_SIZE;
+
+	check_idle("erase");
 
 	if (bno >= NUM_BLOCKS) {
 		fprintf(stderr, "sim: NAND_erase called on "
@@ -151,20 +218,25 @@ int dhara_nand_erase(const struct dhara_nand *n, dhara_block_t bno,
 		if (!stats.frozen)
 			stats.erase_fail++;
 		seq_gen(bno * 57 + 29, blk, BLOCK_SIZE);
+		seq_gen(bno * 57 + 31, blk_spare, PAGES_PER_BLOCK * OOB_SIZE);
 		dhara_set_error(err, DHARA_E_BAD_BLOCK);
 		return -1;
 	}
 
 	memset(blk, 0xff, BLOCK_SIZE);
+	memset(blk_spare, 0xff, PAGES_PER_BLOCK * OOB_SIZE);
 	return 0;
 }
 
-int dhara_nand_prog(const struct dhara_nand *n, dhara_page_t p,
-		    const uint8_t *data, dhara_error_t *err)
+/* Program a page, and optionally its spare area */
+static int prog_page(dhara_page_t p, const uint8_t *data,
+		     const uint8_t *oob, size_t oob_len,
+		     dhara_error_t *err)
 {
 	const int bno = p >> LOG2_PAGES_PER_BLOCK;
 	const int pno = p & ((1 << LOG2_PAGES_PER_BLOCK) - 1);
 	uint8_t *page = pages + (p << LOG2_PAGE_SIZE);
+	uint8_t *page_spare = spare + p * OOB_SIZE;
 
 	if ((bno < 0) || (bno >= NUM_BLOCKS)) {
 		fprintf(stderr, "sim: NAND_prog called on "
@@ -178,6 +250,12 @@ int dhara_nand_prog(const struct dhara_nand *n, dhara_page_t p,
 		abort();
 	}
 
+	if (oob_len > OOB_SIZE) {
+		fprintf(stderr, "sim: NAND_prog: spare data too "
+			"large: %ld\n", oob_len);
+		abort();
+	}
+
 	if (pno < blocks[bno].next_page) {
 		fprintf(stderr, "sim: NAND_prog: out-of-order "
 			"page programming. Block %d, page %d "
@@ -196,19 +274,40 @@ int dhara_nand_prog(const struct dhara_nand *n, dhara_page_t p,
 		if (!stats.frozen)
 			stats.prog_fail++;
 		seq_gen(p * 57 + 29, page, PAGE_SIZE);
+		seq_gen(p * 57 + 31, page_spare, OOB_SIZE);
 		dhara_set_error(err, DHARA_E_BAD_BLOCK);
 		return -1;
 	}
 
 	memcpy(page, data, PAGE_SIZE);
+	if (oob)
+		memcpy(page_spare, oob, oob_len);
 	return 0;
 }
 
+int dhara_nand_prog(const struct dhara_nand *n, dhara_page_t p,
+		    const uint8_t *data, dhara_error_t *err)
+{
+	check_idle("prog");
+	return prog_page(p, data, NULL, 0, err);
+}
+
+int dhara_nand_prog_oob(const struct dhara_nand *n, dhara_page_t p,
+			const uint8_t *data,
+			const uint8_t *oob, size_t length,
+			dhara_error_t *err)
+{
+	check_idle("prog_oob");
+	return prog_page(p, data, oob, length, err);
+}
+
 int dhara_nand_is_free(const struct dhara_nand *n, dhara_page_t p)
 {
 	const int bno = p >> LOG2_PAGES_PER_BLOCK;
 	const int pno = p & ((1 << LOG2_PAGES_PER_BLOCK) - 1);
 
+	check_idle("is_free");
+
 	if ((bno < 0) || (bno >= NUM_BLOCKS)) {
 		fprintf(stderr, "sim: NAND_is_free called on "
 			"invalid block: %d\n", bno);
@@ -227,6 +326,8 @@ int dhara_nand_read(const struct dhara_nand *n, dhara_page_t p,
 	const int bno = p >> LOG2_PAGES_PER_BLOCK;
 	uint8_t *page = pages + (p << LOG2_PAGE_SIZE);
 
+	check_readable("read", p);
+
 	if ((bno < 0) || (bno >= NUM_BLOCKS)) {
 		fprintf(stderr, "sim: NAND_read called on "
 			"invalid block: %d\n", bno);
@@ -263,6 +364,133 @@ int dhara_nand_copy(const struct dhara_nand *n,
 	return 0;
 }
 
+int dhara_nand_read_oob(const struct dhara_nand *n, dhara_page_t p,
+			size_t offset, size_t length,
+			uint8_t *oob, dhara_error_t *err)
+{
+	const int bno = p >> LOG2_PAGES_PER_BLOCK;
+
+	check_readable("read_oob", p);
+
+	if ((bno < 0) || (bno >= NUM_BLOCKS)) {
+		fprintf(stderr, "sim: NAND_read_oob called on "
+			"invalid block: %d\n", bno);
+		abort();
+	}
+
+	if ((offset > OOB_SIZE) || (length > OOB_SIZE) ||
+	    (offset + length > OOB_SIZE)) {
+		fprintf(stderr, "sim: NAND_read_oob called on "
+			"invalid range: offset = %ld, length = %ld\n",
+			offset, length);
+		abort();
+	}
+
+	if (!stats.frozen) {
+		stats.read_oob++;
+		stats.read_bytes += length;
+	}
+
+	memcpy(oob, spare + p * OOB_SIZE + offset, length);
+	return 0;
+}
+
+int dhara_nand_copy_oob(const struct dhara_nand *n,
+			dhara_page_t src, dhara_page_t dst,
+			const uint8_t *oob, size_t length,
+			dhara_error_t *err)
+{
+	uint8_t buf[PAGE_SIZE];
+
+	if ((dhara_nand_read(n, src, 0, PAGE_SIZE, buf, err) < 0) ||
+	    (dhara_nand_prog_oob(n, dst, buf, oob, length, err) < 0))
+		return -1;
+
+	return 0;
+}
+
+/* Erase each block in the group. The simulated chip doesn't really have
+ * planes, so any group of blocks is allowed.
+ */
+int dhara_nand_erase_multi(const struct dhara_nand *n, dhara_block_t bno,
+			   dhara_error_t *err)
+{
+	const int count = 1 << n->log2_planes;
+	int ret = 0;
+	int i;
+
+	if (bno & (count - 1)) {
+		fprintf(stderr, "sim: NAND_erase_multi called on "
+			"unaligned block: %d\n", bno);
+		abort();
+	}
+
+	if (!stats.frozen)
+		stats.erase_multi++;
+
+	for (i = 0; i < count; i++)
+		if (dhara_nand_erase(n, bno + i, err) < 0)
+			ret = -1;
+
+	return ret;
+}
+
+/* The simulated program completes immediately, but its status isn't
+ * reported until the operation is completed.
+ */
+void dhara_nand_prog_submit(const struct dhara_nand *n, dhara_page_t p,
+			    const uint8_t *data)
+{
+	struct async_op *op;
+
+	if (async.busy >= MAX_ASYNC) {
+		fprintf(stderr, "sim: NAND_prog_submit called with "
+			"too many outstanding operations\n");
+		abort();
+	}
+
+	if (async.busy &&
+	    ((p != async.last_page + 1) ||
+	     !(p & ((1 << LOG2_PAGES_PER_BLOCK) - 1)))) {
+		fprintf(stderr, "sim: NAND_prog_submit: cache program "
+			"of non-consecutive page %d (after %d)\n",
+			p, async.last_page);
+		abort();
+	}
+
+	op = &async.ops[async.busy++];
+	op->page = p;
+	op->ret = prog_page(p, data, NULL, 0, &op->err);
+	async.last_page = p;
+
+	if (!stats.frozen)
+		stats.prog_async++;
+}
+
+int dhara_nand_prog_complete(const struct dhara_nand *n,
+			     dhara_error_t *err)
+{
+	struct async_op op;
+
+	if (!async.busy) {
+		fprintf(stderr, "sim: NAND_prog_complete called with "
+			"no outstanding operation\n");
+		abort();
+	}
+
+	op = async.ops[0];
+	memmove(async.ops, async.ops + 1,
+		(MAX_ASYNC - 1) * sizeof(async.ops[0]));
+	async.busy--;
+
+	if (op.ret < 0) {
+		dhara_set_error(err, op.err);
+		return -1;
+	}
+
+	return 0;
+}
+
 static char rep_status(const struct block_status *b)
 {
 	switch (b->flags & (BLOCK_FAILED | BLOCK_BAD_MARK)) {
@@ -330,6 +558,11 @@ void sim_thaw(void)
 	stats.frozen--;
 }
 
+void sim_set_concurrent_reads(int allow)
+{
+	async.concurrent_reads = allow;
+}
+
 void sim_dump(void)
 {
 	int i;
@@ -339,10 +572,13 @@ void sim_dump(void)
 	printf("    mark_bad        %d\n", stats.mark_bad);
 	printf("    erase:          %d\n", stats.erase);
 	printf("    erase failures: %d\n", stats.erase_fail);
+	printf("    erase (multi):  %d\n", stats.erase_multi);
 	printf("    is_erased:      %d\n", stats.is_erased);
 	printf("    prog:           %d\n", stats.prog);
 	printf("    prog failures:  %d\n", stats.prog_fail);
+	printf("    prog (async):   %d\n", stats.prog_async);
 	printf("    read:           %d\n", stats.read);
+	printf("    read (oob):     %d\n", stats.read_oob);
 	printf("    read (bytes):   %d\n", stats.read_bytes);
 	printf("\n");
 
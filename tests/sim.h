@@ -34,6 +34,12 @@ void sim_dump(void);
 void sim_freeze(void);
 void sim_thaw(void);
 
+/* Allow reads while a program is outstanding, as happens when readers
+ * run concurrently with the writer. The page being programmed may
+ * still not be read.
+ */
+void sim_set_concurrent_reads(int allow);
+
 /* Set faults on individual blocks */
 void sim_set_failed(dhara_block_t blk);
 void sim_set_timebomb(dhara_block_t blk, int ttl);
@@ -0,0 +1,197 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include "dhara/map.h"
+#include "util.h"
+#include "mtutil.h"
+#include "sim.h"
+
+#define NUM_SECTORS		100
+
+static void st_assert(struct dhara_map *m,
+		      const struct dhara_map_snapshot *snap,
+		      dhara_sector_t s, int seed)
+{
+	const size_t page_size = 1 << m->journal.nand->log2_page_size;
+	uint8_t buf[page_size];
+	dhara_error_t err;
+
+	if (dhara_map_snapshot_read(m, snap, s, buf, &err) < 0)
+		dabort("snapshot_read", err);
+
+	seq_assert(seed, buf, sizeof(buf));
+}
+
+static void write_round(struct dhara_map *m, int round)
+{
+	int i;
+
+	for (i = 0; i < NUM_SECTORS; i++)
+		mt_write(m, i, round * NUM_SECTORS + i);
+}
+
+static void assert_round(struct dhara_map *m, int round)
+{
+	int i;
+
+	for (i = 0; i < NUM_SECTORS; i++)
+		mt_assert(m, i, round * NUM_SECTORS + i);
+}
+
+static void st_assert_round(struct dhara_map *m,
+			    const struct dhara_map_snapshot *snap, int round)
+{
+	int i;
+
+	for (i = 0; i < NUM_SECTORS; i++)
+		st_assert(m, snap, i, round * NUM_SECTORS + i);
+}
+
+static uint8_t diff_seen[256];
+static int diff_count;
+
+static void diff_cb(void *arg, dhara_sector_t s)
+{
+	assert(s < sizeof(diff_seen));
+	assert(!diff_seen[s]);
+
+	diff_seen[s] = 1;
+	diff_count++;
+}
+
+static void test_diff(struct dhara_map *m)
+{
+	static const dhara_sector_t changed[] = {3, 17, 42, 5, 150};
+	struct dhara_map_snapshot a;
+	struct dhara_map_snapshot b;
+	dhara_error_t err;
+	int i;
+
+	printf("Diff...\n");
+	if (dhara_map_snapshot_create(m, &a, &err) < 0)
+		dabort("snapshot_create", err);
+
+	mt_write(m, 3, 1003);
+	mt_write(m, 17, 1017);
+	mt_write(m, 42, 1042);
+	mt_trim(m, 5);
+	mt_write(m, 150, 1150);
+
+	if (dhara_map_snapshot_create(m, &b, &err) < 0)
+		dabort("snapshot_create", err);
+
+	memset(diff_seen, 0, sizeof(diff_seen));
+	diff_count = 0;
+	if (dhara_map_diff(m, a.root, b.root, diff_cb, NULL, &err) < 0)
+		dabort("map_diff", err);
+
+	/* Pages relocated by padding/GC during sync may also be
+	 * reported, but no more than a handful.
+	 */
+	printf("    reported: %d\n", diff_count);
+	for (i = 0; i < sizeof(changed) / sizeof(changed[0]); i++)
+		assert(diff_seen[changed[i]]);
+	assert(diff_count <= 10);
+
+	diff_count = 0;
+	if (dhara_map_diff(m, b.root, dhara_journal_root(&m->journal),
+			   diff_cb, NULL, &err) < 0)
+		dabort("map_diff", err);
+	assert(!diff_count);
+
+	/* Against an empty map, every mapped sector is reported once */
+	memset(diff_seen, 0, sizeof(diff_seen));
+	diff_count = 0;
+	if (dhara_map_diff(m, DHARA_PAGE_NONE, b.root,
+			   diff_cb, NULL, &err) < 0)
+		dabort("map_diff", err);
+	assert(diff_count == b.count);
+
+	dhara_map_snapshot_release(m, &b);
+	dhara_map_snapshot_release(m, &a);
+}
+
+int main(void)
+{
+	const size_t page_size = 1 << sim_nand.log2_page_size;
+	struct dhara_map map;
+	struct dhara_map_snapshot snap;
+	uint8_t page_buf[page_size];
+	dhara_error_t err;
+	dhara_page_t tail;
+	int i;
+
+	sim_reset();
+	dhara_map_init(&map, &sim_nand, page_buf, MT_GC_RATIO);
+	dhara_map_resume(&map, NULL);
+	printf("capacity: %d\n", dhara_map_capacity(&map));
+
+	/* The first round becomes garbage, which is collected while
+	 * synchronizing to take the snapshot.
+	 */
+	write_round(&map, 0);
+	write_round(&map, 1);
+
+	printf("Snapshot...\n");
+	if (dhara_map_snapshot_create(&map, &snap, &err) < 0)
+		dabort("snapshot_create", err);
+	assert(dhara_map_snapshot_size(&snap) == NUM_SECTORS);
+
+	tail = map.journal.tail;
+	for (i = 2; i < 5; i++) {
+		printf("Write round %d, tail = %d\n", i, map.journal.tail);
+		write_round(&map, i);
+		assert_round(&map, i);
+		st_assert_round(&map, &snap, 1);
+	}
+
+	/* Garbage collection must not have released any of the pinned
+	 * pages.
+	 */
+	printf("tail: %d -> %d\n", tail, map.journal.tail);
+	assert(map.journal.tail == tail);
+
+	printf("Trim all...\n");
+	for (i = 0; i < NUM_SECTORS; i++)
+		mt_trim(&map, i);
+
+	assert(!dhara_map_size(&map));
+	if (dhara_map_sync(&map, &err) < 0)
+		dabort("map_sync", err);
+	st_assert_round(&map, &snap, 1);
+
+	printf("Release...\n");
+	dhara_map_snapshot_release(&map, &snap);
+	assert(!map.snapshots);
+
+	for (i = 5; i < 25; i++)
+		write_round(&map, i);
+
+	assert_round(&map, 24);
+	assert(dhara_map_size(&map) == NUM_SECTORS);
+
+	printf("Resume...\n");
+	mt_resume(&map);
+	assert_round(&map, 24);
+
+	test_diff(&map);
+
+	sim_dump();
+	return 0;
+}
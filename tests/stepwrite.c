@@ -0,0 +1,103 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <assert.h>
+#include "dhara/map.h"
+#include "util.h"
+#include "mtutil.h"
+#include "sim.h"
+
+#define ROUNDS			5
+
+static int total_steps;
+static int max_steps;
+
+/* Write a sector step-wise, checking another sector between steps */
+static void step_write(struct dhara_map *m, dhara_sector_t s, int seed,
+		       dhara_sector_t check, int check_seed)
+{
+	const size_t page_size = 1 << m->journal.nand->log2_page_size;
+	struct dhara_map_write_op op;
+	uint8_t buf[page_size];
+	int steps = 0;
+
+	seq_gen(seed, buf, sizeof(buf));
+	dhara_map_write_start(m, &op, s, buf);
+
+	for (;;) {
+		dhara_error_t err;
+		const int r = dhara_map_write_step(m, &op, &err);
+
+		if (r < 0)
+			dabort("map_write_step", err);
+
+		steps++;
+		if (!r)
+			break;
+
+		if (check_seed >= 0)
+			mt_assert(m, check, check_seed);
+	}
+
+	total_steps += steps;
+	if (steps > max_steps)
+		max_steps = steps;
+}
+
+int main(void)
+{
+	const size_t page_size = 1 << sim_nand.log2_page_size;
+	uint8_t page_buf[page_size];
+	struct dhara_map map;
+	int r;
+	int i;
+
+	sim_reset();
+	sim_inject_bad(10);
+	sim_inject_timebombs(30, 20);
+
+	printf("Map init\n");
+	dhara_map_init(&map, &sim_nand, page_buf, MT_GC_RATIO);
+	dhara_map_resume(&map, NULL);
+	printf("  capacity: %d\n", dhara_map_capacity(&map));
+	printf("\n");
+
+	/* Each round rewrites every sector. While writing sector i, we
+	 * check sector i - 1, which was written earlier in this round.
+	 */
+	for (r = 0; r < ROUNDS; r++) {
+		printf("Round %d...\n", r);
+
+		for (i = 0; i < MT_NUM_SECTORS; i++)
+			step_write(&map, i, r * MT_NUM_SECTORS + i, i - 1,
+				   i ? r * MT_NUM_SECTORS + i - 1 : -1);
+	}
+
+	printf("Sync/resume...\n");
+	mt_resume(&map);
+
+	printf("Read back...\n");
+	for (i = 0; i < MT_NUM_SECTORS; i++)
+		mt_assert(&map, i, (ROUNDS - 1) * MT_NUM_SECTORS + i);
+
+	printf("  writes: %d, steps: %d, max steps per write: %d\n",
+	       ROUNDS * MT_NUM_SECTORS, total_steps, max_steps);
+	assert(max_steps > 1);
+
+	sim_dump();
+	return 0;
+}
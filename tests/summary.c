@@ -0,0 +1,117 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include "dhara/map.h"
+#include "util.h"
+#include "mtutil.h"
+#include "sim.h"
+
+#define ROUNDS			5
+
+static int summaries;
+
+/* If the journal holds a summary of the root, it must match the root's
+ * metadata as stored on the checkpoint page.
+ */
+static void check_summary(struct dhara_map *m)
+{
+	const dhara_page_t root = dhara_journal_root(&m->journal);
+	uint8_t meta[DHARA_META_SIZE];
+	uint8_t s[DHARA_META_SIZE];
+	dhara_error_t err;
+
+	if (dhara_journal_summary(&m->journal, root, s) < 0)
+		return;
+
+	if (dhara_journal_read_cp_meta(&m->journal, root, meta, &err) < 0)
+		dabort("read_cp_meta", err);
+
+	assert(!memcmp(s, meta, sizeof(meta)));
+	summaries++;
+}
+
+static void mt_check_all(struct dhara_map *m, int r)
+{
+	int i;
+
+	for (i = 0; i < MT_NUM_SECTORS; i++) {
+		if ((i + r) % 3)
+			mt_assert(m, i, r * MT_NUM_SECTORS + i);
+		else
+			mt_assert_blank(m, i);
+	}
+}
+
+int main(void)
+{
+	const size_t page_size = 1 << sim_nand.log2_page_size;
+	uint8_t page_buf[page_size];
+	struct dhara_map map;
+	uint8_t meta[DHARA_META_SIZE];
+	dhara_error_t err;
+	int r;
+	int i;
+
+	sim_reset();
+	sim_inject_bad(10);
+	sim_inject_timebombs(30, 20);
+
+	printf("Map init\n");
+	dhara_map_init(&map, &sim_nand, page_buf, MT_GC_RATIO);
+	dhara_map_resume(&map, NULL);
+	printf("  capacity: %d\n", dhara_map_capacity(&map));
+	printf("\n");
+
+	mt_hook = check_summary;
+
+	for (r = 0; r < ROUNDS; r++) {
+		printf("Round %d...\n", r);
+
+		for (i = 0; i < MT_NUM_SECTORS; i++) {
+			if ((i + r) % 3)
+				mt_write(&map, i, r * MT_NUM_SECTORS + i);
+			else
+				mt_trim(&map, i);
+		}
+
+		mt_check_all(&map, r);
+
+		/* After a sync, the root is always summarized */
+		if (dhara_map_sync(&map, &err) < 0)
+			dabort("map_sync", err);
+
+		assert(!dhara_journal_summary(&map.journal,
+			dhara_journal_root(&map.journal), meta));
+		check_summary(&map);
+		mt_check_all(&map, r);
+
+		/* ...and also after resume */
+		mt_resume(&map);
+
+		assert(!dhara_journal_summary(&map.journal,
+			dhara_journal_root(&map.journal), meta));
+		check_summary(&map);
+		mt_check_all(&map, r);
+	}
+
+	printf("  summaries checked: %d\n", summaries);
+	sim_dump();
+	return 0;
+}
@@ -0,0 +1,329 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "dhara/tsmap.h"
+#include "util.h"
+#include "sim.h"
+
+#define GC_RATIO		4
+#define NUM_STABLE		50
+#define NUM_VOLATILE		50
+#define READS_PER_THREAD	20000
+#define MAX_READERS		4
+
+static pthread_rwlock_t rwlock = PTHREAD_RWLOCK_INITIALIZER;
+
+static void rw_lock_shared(void *arg)
+{
+	pthread_rwlock_rdlock(arg);
+}
+
+static int rw_try_lock_shared(void *arg)
+{
+	return pthread_rwlock_tryrdlock(arg);
+}
+
+static void rw_lock_exclusive(void *arg)
+{
+	pthread_rwlock_wrlock(arg);
+}
+
+static int rw_try_lock_exclusive(void *arg)
+{
+	return pthread_rwlock_trywrlock(arg);
+}
+
+static void rw_unlock(void *arg)
+{
+	pthread_rwlock_unlock(arg);
+}
+
+static const struct dhara_tsmap_lock rw_ops = {
+	.arg			= &rwlock,
+	.lock_shared		= rw_lock_shared,
+	.try_lock_shared	= rw_try_lock_shared,
+	.unlock_shared		= rw_unlock,
+	.lock_exclusive		= rw_lock_exclusive,
+	.try_lock_exclusive	= rw_try_lock_exclusive,
+	.unlock_exclusive	= rw_unlock
+};
+
+static struct dhara_tsmap map;
+static volatile int readers_done;
+
+/* Readers check the stable sectors, which are written once before the
+ * threads start and never touched again. The expected contents are
+ * generated in advance, because seq_gen() isn't thread-safe.
+ */
+static uint8_t stable[NUM_STABLE][1 << 9];
+
+/* CPU time used by each reader, in seconds */
+static double reader_cpu[MAX_READERS];
+
+static double cpu_time(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void *reader_thread(void *arg)
+{
+	const size_t page_size = 1 << sim_nand.log2_page_size;
+	unsigned int seed = (unsigned long)arg;
+	const double start = cpu_time();
+	uint8_t buf[page_size];
+	int i;
+
+	for (i = 0; i < READS_PER_THREAD; i++) {
+		const dhara_sector_t s = (seed + i * 7) % NUM_STABLE;
+		dhara_error_t err;
+
+		if (dhara_tsmap_read(&map, s, buf, &err) < 0)
+			dabort("tsmap_read", err);
+
+		if (memcmp(buf, stable[s], page_size)) {
+			fprintf(stderr, "reader: mismatch in sector %d\n",
+				s);
+			abort();
+		}
+	}
+
+	reader_cpu[seed] = cpu_time() - start;
+	return NULL;
+}
+
+/* The writer rewrites the volatile sectors until the readers finish.
+ * A write may still be in progress when it returns, so the buffers are
+ * used alternately.
+ */
+static void *writer_thread(void *arg)
+{
+	const size_t page_size = 1 << sim_nand.log2_page_size;
+	uint8_t bufs[2][page_size];
+	int *count = arg;
+
+	while (!readers_done) {
+		const dhara_sector_t s = NUM_STABLE +
+			(*count % NUM_VOLATILE);
+		uint8_t *buf = bufs[*count & 1];
+		dhara_error_t err;
+
+		seq_gen(*count, buf, page_size);
+		if (dhara_tsmap_write(&map, s, buf, &err) < 0)
+			dabort("tsmap_write", err);
+
+		if (!(*count % 16) && dhara_tsmap_sync(&map, &err) < 0)
+			dabort("tsmap_sync", err);
+
+		(*count)++;
+	}
+
+	return NULL;
+}
+
+static void check_read(dhara_sector_t s, int seed)
+{
+	const size_t page_size = 1 << sim_nand.log2_page_size;
+	uint8_t buf[page_size];
+	dhara_error_t err;
+
+	if (dhara_tsmap_read(&map, s, buf, &err) < 0)
+		dabort("tsmap_read", err);
+
+	seq_assert(seed, buf, page_size);
+}
+
+/* Exercise snapshots, readers and step-wise writes on one of the
+ * volatile sectors, before the threads start.
+ */
+static void check_views(void)
+{
+	const size_t page_size = 1 << sim_nand.log2_page_size;
+	const dhara_sector_t s = NUM_STABLE;
+	static uint8_t bufs[3][1 << 9];
+	struct dhara_map_snapshot snap;
+	struct dhara_map_reader r;
+	struct dhara_map_write_op op;
+	uint8_t buf[page_size];
+	dhara_error_t err;
+	int i;
+
+	for (i = 0; i < 3; i++)
+		seq_gen(1000 + i, bufs[i], page_size);
+
+	if (dhara_tsmap_write(&map, s, bufs[0], &err) < 0)
+		dabort("tsmap_write", err);
+
+	if (dhara_tsmap_snapshot_create(&map, &snap, &err) < 0)
+		dabort("tsmap_snapshot_create", err);
+
+	dhara_tsmap_write_start(&map, &op, s, bufs[1]);
+	while ((i = dhara_tsmap_write_step(&map, &op, &err)) > 0)
+		check_read(0, 0);
+	if (i < 0)
+		dabort("tsmap_write_step", err);
+
+	if (dhara_tsmap_sync(&map, &err) < 0)
+		dabort("tsmap_sync", err);
+	dhara_tsmap_reader_begin(&map, &r);
+
+	if (dhara_tsmap_write(&map, s, bufs[2], &err) < 0)
+		dabort("tsmap_write", err);
+
+	check_read(s, 1002);
+
+	if (dhara_tsmap_snapshot_read(&map, &snap, s, buf, &err) < 0)
+		dabort("tsmap_snapshot_read", err);
+	seq_assert(1000, buf, page_size);
+
+	if (dhara_tsmap_reader_read(&map, &r, s, buf, &err) < 0)
+		dabort("tsmap_reader_read", err);
+	seq_assert(1001, buf, page_size);
+
+	dhara_tsmap_reader_end(&map, &r);
+	dhara_tsmap_snapshot_release(&map, &snap);
+}
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* Run the given number of readers, with or without a concurrent
+ * writer. Besides throughput, report the CPU time per read: if the
+ * shared path scales, it stays flat as readers are added, even on a
+ * host with too few CPUs for throughput to rise.
+ */
+static void run(int nr, int with_writer)
+{
+	pthread_t readers[MAX_READERS];
+	pthread_t writer;
+	int writes = 0;
+	unsigned long sw = map.shared_waits;
+	unsigned long ew = map.exclusive_waits;
+	double start;
+	double elapsed;
+	double cpu = 0;
+	int i;
+
+	readers_done = 0;
+	start = now();
+
+	if (with_writer &&
+	    pthread_create(&writer, NULL, writer_thread, &writes))
+		dabort("pthread_create", DHARA_E_NONE);
+
+	for (i = 0; i < nr; i++)
+		if (pthread_create(&readers[i], NULL, reader_thread,
+				   (void *)(unsigned long)i))
+			dabort("pthread_create", DHARA_E_NONE);
+
+	for (i = 0; i < nr; i++) {
+		pthread_join(readers[i], NULL);
+		cpu += reader_cpu[i];
+	}
+
+	readers_done = 1;
+	if (with_writer)
+		pthread_join(writer, NULL);
+	elapsed = now() - start;
+
+	printf("%d reader(s): %8.0f reads/s, %5.0f ns/read, %6d writes, "
+	       "waits: %lu shared, %lu exclusive\n",
+	       nr, nr * READS_PER_THREAD / elapsed,
+	       cpu * 1e9 / (nr * READS_PER_THREAD), writes,
+	       map.shared_waits - sw, map.exclusive_waits - ew);
+}
+
+int main(void)
+{
+	const size_t page_size = 1 << sim_nand.log2_page_size;
+	uint8_t page_buf[page_size];
+	uint8_t spare_buf[page_size];
+	uint8_t buf[page_size];
+	dhara_error_t err;
+	dhara_page_t pending;
+	int i;
+
+	sim_reset();
+	sim_inject_bad(10);
+
+	printf("resume\n");
+	dhara_tsmap_init(&map, &sim_nand, page_buf, GC_RATIO, &rw_ops);
+	dhara_journal_set_spare_buf(&map.map.journal, spare_buf);
+	dhara_tsmap_resume(&map, NULL);
+	printf("  capacity: %d\n", dhara_tsmap_capacity(&map));
+
+	for (i = 0; i < NUM_STABLE; i++) {
+		seq_gen(i, stable[i], page_size);
+		if (dhara_tsmap_write(&map, i, stable[i], &err) < 0)
+			dabort("tsmap_write", err);
+	}
+
+	if (dhara_tsmap_sync(&map, &err) < 0)
+		dabort("tsmap_sync", err);
+
+	/* A lookup doesn't wait for an outstanding write, and sees its
+	 * data.
+	 */
+	seq_gen(12345, buf, page_size);
+	if (dhara_tsmap_write(&map, NUM_STABLE, buf, &err) < 0)
+		dabort("tsmap_write", err);
+
+	pending = map.map.journal.pending;
+	sim_set_concurrent_reads(1);
+	check_read(NUM_STABLE, 12345);
+	check_read(0, 0);
+	assert(map.map.journal.pending == pending);
+
+	if (dhara_tsmap_complete(&map, &err) < 0)
+		dabort("tsmap_complete", err);
+	assert(map.map.journal.pending == DHARA_PAGE_NONE);
+	check_read(NUM_STABLE, 12345);
+
+	check_views();
+
+	/* The simulator's statistics aren't thread-safe */
+	printf("%ld CPU(s) online\n", sysconf(_SC_NPROCESSORS_ONLN));
+
+	sim_freeze();
+	printf("Readers only:\n");
+	for (i = 1; i <= MAX_READERS; i <<= 1)
+		run(i, 0);
+
+	printf("Readers and a writer:\n");
+	for (i = 1; i <= MAX_READERS; i <<= 1)
+		run(i, 1);
+	sim_thaw();
+
+	for (i = 0; i < NUM_STABLE; i++)
+		check_read(i, i);
+
+	sim_dump();
+	return 0;
+}
@@ -16,49 +16,128 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
-static uint32_t table[256];
+#define MAX_SLICES	8
+#define MAX_WORDS	8
 
-static void fill_table(uint32_t poly)
+/* Polynomials wider than 64 bits are held as several words, least
+ * significant first, and so is each table entry.
+ */
+static uint64_t poly[MAX_WORDS];
+static int poly_words = 1;
+
+static uint64_t table[MAX_SLICES * 256 * MAX_WORDS];
+
+/* Compute a byte-wise reduction table for a polynomial in reciprocal
+ * form (LSB -> highest-order term), without its x^0 term. This serves
+ * for the CRC32 table, and also for BCH generators (shifted right by one
+ * bit to drop the x^0 term).
+ *
+ * For slice-by-N reduction, table k gives the remainder of a byte
+ * followed by k zero bytes. This is supported only for polynomials of
+ * up to 64 bits.
+ */
+static void fill_table(int slices)
 {
 	int i;
 
 	for (i = 0; i < 256; i++) {
-		uint32_t r = i;
+		uint64_t *r = table + i * poly_words;
 		int j;
 
-		for (j = 0; j < 8; j++)
-			r = (r >> 1) ^ ((r & 1) ? poly : 0);
+		r[0] = i;
+
+		for (j = 0; j < 8; j++) {
+			const int carry = r[0] & 1;
+			int k;
+
+			for (k = 0; k < poly_words - 1; k++)
+				r[k] = (r[k] >> 1) | (r[k + 1] << 63);
+			r[k] >>= 1;
+
+			if (carry)
+				for (k = 0; k < poly_words; k++)
+					r[k] ^= poly[k];
+		}
+	}
+
+	for (i = 256; i < (slices << 8); i++) {
+		const uint64_t r = table[i - 256];
 
-		table[i] = r;
+		table[i] = (r >> 8) ^ table[r & 0xff];
 	}
 }
 
-static void print_table(void)
+static void print_table(int digits, int slices)
+{
+	const int per_line = (digits > 8) ? 2 : 4;
+	const int count = (slices << 8) * poly_words;
+	int i;
+
+	for (i = 0; i < count; i++)
+		printf("0x%0*llx,%c", digits, (unsigned long long)table[i],
+		       ((i % per_line) == per_line - 1) ? '\n' : ' ');
+}
+
+/* Print carry-less multiply folding constants (see ecc/clmul.h): powers
+ * of x modulo the polynomial, in reflected form widened to 64 bits.
+ */
+static int print_fold(void)
 {
+	static const int powers[] = {575, 511, 191, 127};
+	int width = 64;
 	int i;
 
-	for (i = 0; i < 256; i++)
-		printf("0x%08x,%c", table[i], ((i & 3) == 3) ? '\n' : ' ');
+	if ((poly_words > 1) || !poly[0]) {
+		fprintf(stderr, "print_fold: need a polynomial of up to "
+			"64 bits\n");
+		return -1;
+	}
+
+	while (!(poly[0] >> (width - 1)))
+		width--;
+
+	for (i = 0; i < 4; i++) {
+		uint64_t r = ((uint64_t)1) << (width - 1);
+		int j;
+
+		for (j = 0; j < powers[i]; j++)
+			r = (r & 1) ? ((r >> 1) ^ poly[0]) : (r >> 1);
+
+		printf("0x%016llx,%c", (unsigned long long)(r << (64 - width)),
+		       (i & 1) ? '\n' : ' ');
+	}
+
+	return 0;
 }
 
-static int parse_poly(const char *text, uint32_t *out)
+static int parse_poly(const char *text)
 {
-	uint32_t r = 0;
+	int i;
 
 	while ((*text == '0') || (*text == 'x'))
 		text++;
 
+	if (strlen(text) > MAX_WORDS * 16) {
+		fprintf(stderr, "parse_poly: polynomial too wide\n");
+		return -1;
+	}
+
 	while (*text) {
 		char c = *(text++);
 
-		r <<= 4;
+		for (i = MAX_WORDS - 1; i > 0; i--)
+			poly[i] = (poly[i] << 4) | (poly[i - 1] >> 60);
+		poly[0] <<= 4;
+
 		if ((c >= '0') && (c <= '9')) {
-			r |= (c - '0');
+			poly[0] |= (c - '0');
 		} else if ((c >= 'A') && (c <= 'F')) {
-			r |= (c - 'A' + 10);
+			poly[0] |= (c - 'A' + 10);
 		} else if ((c >= 'a') && (c <= 'f')) {
-			r |= (c - 'a' + 10);
+			poly[0] |= (c - 'a' + 10);
 		} else {
 			fprintf(stderr, "parse_poly: invalid character: %s\n",
 				text);
@@ -66,23 +145,49 @@ static int parse_poly(const char *text, uint32_t *out)
 		}
 	}
 
-	*out = r;
+	for (i = MAX_WORDS - 1; i > 0; i--)
+		if (poly[i])
+			break;
+
+	poly_words = i + 1;
 	return 0;
 }
 
 int main(int argc, char **argv)
 {
-	uint32_t p;
+	int digits = 8;
+	int slices = 1;
 
 	if (argc < 2) {
-		fprintf(stderr, "usage: %s <polynomial>\n", argv[0]);
+		fprintf(stderr, "usage: %s <polynomial> [slices|fold]\n",
+			argv[0]);
 		return -1;
 	}
 
-	if (parse_poly(argv[1], &p) < 0)
+	if (parse_poly(argv[1]) < 0)
 		return -1;
 
-	fill_table(p);
-	print_table();
+	if ((argc >= 3) && !strcmp(argv[2], "fold"))
+		return print_fold();
+
+	if (argc >= 3) {
+		slices = atoi(argv[2]);
+		if ((slices < 1) || (slices > MAX_SLICES) ||
+		    ((slices > 1) && (poly_words > 1))) {
+			fprintf(stderr, "invalid number of slices: %s\n",
+				argv[2]);
+			return -1;
+		}
+	}
+
+	/* Table entries are no wider than the polynomial */
+	if (poly_words > 1)
+		digits = 16;
+
+	while ((digits < 16) && (poly[0] >> (digits * 4)))
+		digits++;
+
+	fill_table(slices);
+	print_table(digits, slices);
 	return 0;
 }
@@ -0,0 +1,111 @@
+/* Dhara - NAND flash management layer
+ * Copyright (C) 2013 Daniel Beer <dlbeer@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+#include "ecc/gf13.h"
+#include "ecc/bch.h"
+
+/* Benchmark for the GF(2^13) arithmetic options. Build as
+ * tools/gfbench (full tables), tools/gfbench.small (GF13_SMALL_TABLES)
+ * or tools/gfbench.serial (GF13_NO_TABLES), and compare.
+ */
+
+#define OPS		(1 << 20)
+#define CHUNK_SIZE	512
+
+static gf13_elem_t operands[1024];
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void bench_field(void)
+{
+	gf13_elem_t r = 1;
+	double start;
+	int i;
+
+	for (i = 0; i < 1024; i++)
+		operands[i] = (random() % GF13_ORDER) + 1;
+
+	start = now();
+	for (i = 0; i < OPS; i++)
+		r = gf13_mul(r, operands[i & 1023]);
+	printf("gf13_mul: %8.1f ns\n", (now() - start) * 1e9 / OPS);
+
+	start = now();
+	for (i = 0; i < OPS; i++)
+		r = gf13_div(operands[i & 1023], r);
+	printf("gf13_div: %8.1f ns\n", (now() - start) * 1e9 / OPS);
+
+	/* Keep the result live */
+	if (!r)
+		printf("(zero)\n");
+}
+
+static void bench_repair(const struct bch_def *def, const char *name)
+{
+	const int nerr = def->syns / 2;
+	const int rounds = 2000;
+	uint8_t block[CHUNK_SIZE];
+	uint8_t ecc[BCH_MAX_ECC];
+	uint8_t bad[CHUNK_SIZE];
+	double elapsed = 0;
+	int i;
+
+	for (i = 0; i < CHUNK_SIZE; i++)
+		block[i] = random();
+
+	bch_generate(def, block, CHUNK_SIZE, ecc);
+
+	for (i = 0; i < rounds; i++) {
+		double start;
+		int j;
+
+		memcpy(bad, block, CHUNK_SIZE);
+		for (j = 0; j < nerr; j++) {
+			const int bit = random() % (CHUNK_SIZE * 8);
+
+			bad[bit >> 3] ^= 1 << (bit & 7);
+		}
+
+		start = now();
+		bch_repair(def, bad, CHUNK_SIZE, ecc);
+		elapsed += now() - start;
+	}
+
+	printf("%s repair (%d errors): %8.1f us\n",
+	       name, nerr, elapsed * 1e6 / rounds);
+}
+
+int main(void)
+{
+	srandom(0);
+	bench_field();
+	bench_repair(&bch_4bit, "bch_4bit");
+	bench_repair(&bch_8bit, "bch_8bit");
+	bench_repair(&bch_16bit, "bch_16bit");
+	return 0;
+}
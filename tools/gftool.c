@@ -40,21 +40,6 @@ static poly_t reciprocal(poly_t p)
 	return r;
 }
 
-static poly_t mul_poly(poly_t a, poly_t b)
-{
-	poly_t r = 0;
-
-	while (a) {
-		if (a & 1)
-			r ^= b;
-
-		a >>= 1;
-		b <<= 1;
-	}
-
-	return r;
-}
-
 static int degree(poly_t p)
 {
 	int d = 0;
@@ -92,6 +77,124 @@ static void print_poly(char var, poly_t p)
 	}
 }
 
+/************************************************************************
+ * Wide polynomials, for BCH generators of degree 64 and above. Words
+ * are stored least significant first.
+ */
+
+#define WIDE_WORDS	8
+#define WIDE_BITS	(WIDE_WORDS * 64)
+
+typedef poly_t wide_t[WIDE_WORDS];
+
+static int wide_bit(const wide_t p, int i)
+{
+	return (p[i >> 6] >> (i & 63)) & 1;
+}
+
+static int wide_degree(const wide_t p)
+{
+	int i;
+
+	for (i = WIDE_BITS - 1; i > 0; i--)
+		if (wide_bit(p, i))
+			break;
+
+	return i;
+}
+
+/* Multiply a wide polynomial by a narrow one */
+static void wide_mul(wide_t r, poly_t m)
+{
+	wide_t s;
+	wide_t t;
+	int i;
+
+	memcpy(s, r, sizeof(s));
+	memset(t, 0, sizeof(t));
+
+	while (m) {
+		if (m & 1)
+			for (i = 0; i < WIDE_WORDS; i++)
+				t[i] ^= s[i];
+
+		for (i = WIDE_WORDS - 1; i > 0; i--)
+			s[i] = (s[i] << 1) | (s[i - 1] >> 63);
+		s[0] <<= 1;
+		m >>= 1;
+	}
+
+	memcpy(r, t, sizeof(t));
+}
+
+static void wide_reciprocal(const wide_t p, wide_t r)
+{
+	const int d = wide_degree(p);
+	int i;
+
+	memset(r, 0, sizeof(wide_t));
+
+	for (i = 0; i <= d; i++)
+		if (wide_bit(p, i))
+			r[(d - i) >> 6] |= ((poly_t)1) << ((d - i) & 63);
+}
+
+static void print_wide_hex(const wide_t p)
+{
+	int i = WIDE_WORDS - 1;
+
+	while (i && !p[i])
+		i--;
+
+	printf("0x%lx", p[i]);
+	while (i--)
+		printf("%016lx", p[i]);
+}
+
+static void print_wide(char var, const wide_t p)
+{
+	wide_t r;
+	int have_term = 0;
+	int i;
+
+	wide_reciprocal(p, r);
+	print_wide_hex(p);
+	printf(" [");
+	print_wide_hex(r);
+	printf("] -> ");
+
+	for (i = wide_degree(p); i >= 0; i--) {
+		if (!wide_bit(p, i))
+			continue;
+
+		if (have_term)
+			printf(" + ");
+
+		if (!i)
+			printf("1");
+		else if (i == 1)
+			printf("%c", var);
+		else
+			printf("%c^%d", var, i);
+
+		have_term = 1;
+	}
+}
+
+/* Print the reciprocal form as a C initializer */
+static void print_wide_words(const wide_t p)
+{
+	wide_t r;
+	const int n = (wide_degree(p) >> 6) + 1;
+	int i;
+
+	wide_reciprocal(p, r);
+	printf("{");
+	for (i = 0; i < n; i++)
+		printf("%s0x%lx", i ? ", " : " ", r[i]);
+	printf(" }");
+}
+
 /************************************************************************
  * Galois field exponential tables
  */
@@ -285,11 +388,11 @@ static gf_elem_t minimal(gf_elem_t x)
 /* Find the product of minimal polynomials of the first N powers of
  * alpha.
  */
-static int bch_generator(gf_elem_t n, poly_t *out)
+static int bch_generator(gf_elem_t n, wide_t out)
 {
 	const size_t bm_memsz = bit_memsz(1 << (gf_degree + 1));
 	uint8_t *bm;
-	poly_t r = 1;
+	wide_t r = {1};
 	gf_elem_t i;
 
 	if (n >= gf_order) {
@@ -315,12 +418,13 @@ static int bch_generator(gf_elem_t n, poly_t *out)
 		print_poly('x', m);
 
 		if (!bit_test(bm, m)) {
-			if (degree(m) + degree(r) > MAX_DEGREE) {
+			if (degree(m) + wide_degree(r) >= WIDE_BITS) {
 				fprintf(stderr, "bch_generator: overflow\n");
+				free(bm);
 				return -1;
 			}
 
-			r = mul_poly(r, m);
+			wide_mul(r, m);
 			bit_set(bm, m);
 			printf("\n");
 		} else {
@@ -329,11 +433,15 @@ static int bch_generator(gf_elem_t n, poly_t *out)
 	}
 
 	printf("    generator: ");
-	print_poly('x', r);
+	print_wide('x', r);
+	printf("\n");
+	printf("    degree: %d\n", wide_degree(r));
+	printf("    reciprocal words: ");
+	print_wide_words(r);
 	printf("\n");
 
 	if (out)
-		*out = r;
+		memcpy(out, r, sizeof(wide_t));
 
 	free(bm);
 	return 0;
@@ -409,14 +517,14 @@ int main(int argc, char **argv)
 	} else if (!strcasecmp(argv[2], "log")) {
 		gf_dump(gf_log);
 	} else if (!strcasecmp(argv[2], "bch")) {
-		poly_t gen;
+		wide_t gen;
 
 		if (argc < 4) {
 			usage(argv[0]);
 			return 1;
 		}
 
-		if (bch_generator(atoi(argv[3]), &gen) < 0)
+		if (bch_generator(atoi(argv[3]), gen) < 0)
 			r = -1;
 	} else {
 		fprintf(stderr, "unknown operation: %s\n", argv[2]);